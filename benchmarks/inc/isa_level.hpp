@@ -0,0 +1,59 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#if (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_ARM64EC)
+#include <isa_availability.h>
+
+// The vectorized algorithms pick their instruction set by testing __isa_enabled on every call.
+// The benchmarks link the same copy of it, so lowering it here selects which tier gets measured.
+extern "C" long __isa_enabled;
+
+enum class isa_level : int {
+    scalar = __ISA_AVAILABLE_SSE2,
+    sse42  = __ISA_AVAILABLE_SSE42,
+    avx2   = __ISA_AVAILABLE_AVX2,
+    avx512 = __ISA_AVAILABLE_AVX512,
+};
+
+class isa_level_limit {
+public:
+    explicit isa_level_limit(const isa_level level) noexcept : saved(__isa_enabled) {
+        __isa_enabled &= (2L << static_cast<int>(level)) - 1;
+    }
+
+    isa_level_limit(const isa_level_limit&)            = delete;
+    isa_level_limit& operator=(const isa_level_limit&) = delete;
+
+    ~isa_level_limit() {
+        __isa_enabled = saved;
+    }
+
+private:
+    long saved;
+};
+
+template <isa_level Level, void (*Bm)(benchmark::State&)>
+void isa_bm(benchmark::State& state) {
+    if ((__isa_enabled & (1L << static_cast<int>(Level))) == 0) {
+        state.SkipWithError("instruction set not available on this machine");
+        return;
+    }
+
+    isa_level_limit limit{Level};
+    Bm(state);
+}
+
+// Registers the benchmark once for each instruction set tier of the vectorized algorithms, with the given arguments.
+#define BENCHMARK_ISA_LEVELS(apply, ...)                             \
+    BENCHMARK(isa_bm<isa_level::scalar, __VA_ARGS__>)->Apply(apply); \
+    BENCHMARK(isa_bm<isa_level::sse42, __VA_ARGS__>)->Apply(apply);  \
+    BENCHMARK(isa_bm<isa_level::avx2, __VA_ARGS__>)->Apply(apply);   \
+    BENCHMARK(isa_bm<isa_level::avx512, __VA_ARGS__>)->Apply(apply)
+#else // ^^^ x86 or x64 / other architectures vvv
+// Other architectures have a single tier, which the plain registrations already measure.
+#define BENCHMARK_ISA_LEVELS(apply, ...) static_assert(true)
+#endif // ^^^ other architectures ^^^
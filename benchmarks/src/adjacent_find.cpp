@@ -0,0 +1,111 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "isa_level.hpp"
+
+enum class Op {
+    AdjacentFind,
+    IsSortedUntil,
+    Unique,
+};
+
+using namespace std;
+
+template <class T, Op Operation>
+void bm(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto pos  = static_cast<size_t>(state.range(1));
+
+    // The pair each algorithm looks for starts at pos: before it, is_sorted_until sees a non-decreasing range
+    // and adjacent_find and unique see no equal neighbors.
+    vector<T> src(size);
+    for (size_t i = 0; i != size; ++i) {
+        if constexpr (Operation == Op::IsSortedUntil) {
+            src[i] = static_cast<T>(1 + i * 100 / size);
+        } else {
+            src[i] = static_cast<T>(i % 64);
+        }
+    }
+
+    if (pos + 1 < size) {
+        if constexpr (Operation == Op::IsSortedUntil) {
+            src[pos + 1] = T{0};
+        } else {
+            src[pos + 1] = src[pos];
+        }
+    }
+
+    vector<T> a = src;
+
+    for (auto _ : state) {
+        if constexpr (Operation == Op::AdjacentFind) {
+            benchmark::DoNotOptimize(adjacent_find(a.begin(), a.end()));
+        } else if constexpr (Operation == Op::IsSortedUntil) {
+            benchmark::DoNotOptimize(is_sorted_until(a.begin(), a.end()));
+        } else if constexpr (Operation == Op::Unique) {
+            state.PauseTiming();
+            a = src;
+            state.ResumeTiming();
+            benchmark::DoNotOptimize(unique(a.begin(), a.end()));
+        }
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(size * sizeof(T)));
+}
+
+template <class T>
+void bm_unique_runs(benchmark::State& state) {
+    // sorted IDs with runs of duplicates, the common input of unique
+    const auto size = static_cast<size_t>(state.range(0));
+    vector<T> src(size);
+    for (size_t i = 0; i != size; ++i) {
+        src[i] = static_cast<T>(i / 3);
+    }
+
+    vector<T> a;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        a = src;
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(unique(a.begin(), a.end()));
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(size * sizeof(T)));
+}
+
+void common_args(auto bm) {
+    // (size, position of the pair); is_sorted_until and adjacent_find stop there, unique compacts after it
+    bm->Args({3000, 2900})->Args({3000, 10})->Args({63, 62})->Args({31, 30})->Args({15, 14});
+}
+
+BENCHMARK(bm<uint8_t, Op::AdjacentFind>)->Apply(common_args);
+BENCHMARK(bm<uint16_t, Op::AdjacentFind>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Op::AdjacentFind>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Op::AdjacentFind>)->Apply(common_args);
+
+BENCHMARK(bm<int8_t, Op::IsSortedUntil>)->Apply(common_args);
+BENCHMARK(bm<uint16_t, Op::IsSortedUntil>)->Apply(common_args);
+BENCHMARK(bm<int32_t, Op::IsSortedUntil>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Op::IsSortedUntil>)->Apply(common_args);
+BENCHMARK(bm<float, Op::IsSortedUntil>)->Apply(common_args);
+BENCHMARK(bm<double, Op::IsSortedUntil>)->Apply(common_args);
+
+BENCHMARK(bm<uint8_t, Op::Unique>)->Apply(common_args);
+BENCHMARK(bm<uint16_t, Op::Unique>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Op::Unique>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Op::Unique>)->Apply(common_args);
+
+BENCHMARK(bm_unique_runs<uint32_t>)->Arg(3000)->Arg(1'000'000);
+BENCHMARK(bm_unique_runs<uint64_t>)->Arg(3000)->Arg(1'000'000);
+
+BENCHMARK_ISA_LEVELS(common_args, bm<int32_t, Op::IsSortedUntil>);
+BENCHMARK_ISA_LEVELS(common_args, bm<uint32_t, Op::Unique>);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// This file is built twice: as benchmark-deque_push_pop with the default 16-byte blocks,
+// and as benchmark-deque_push_pop_large_blocks with _USE_DEQUE_LARGE_BLOCKS=1.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+using namespace std;
+
+struct order {
+    uint64_t id;
+    uint32_t quantity;
+    uint32_t price;
+    uint64_t timestamp;
+};
+
+template <class T>
+void bm_queue(benchmark::State& state) {
+    // steady-state FIFO: the queue holds state.range(0) elements while each iteration pushes and pops one
+    const auto depth = static_cast<size_t>(state.range(0));
+    deque<T> q(depth);
+
+    for (auto _ : state) {
+        q.push_back(T{});
+        benchmark::DoNotOptimize(q.front());
+        q.pop_front();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <class T>
+void bm_fill_drain(benchmark::State& state) {
+    // a fresh deque grows to state.range(0) elements with push_back, then drains with pop_front
+    const auto size = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        deque<T> q;
+        for (size_t i = 0; i < size; ++i) {
+            q.push_back(T{});
+        }
+        benchmark::DoNotOptimize(q);
+        while (!q.empty()) {
+            q.pop_front();
+        }
+        benchmark::DoNotOptimize(q);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+template <class T>
+void bm_iterate(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const deque<T> q(size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(q);
+        size_t count = 0;
+        for (const auto& elem : q) {
+            benchmark::DoNotOptimize(elem);
+            ++count;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+void common_args(auto bm) {
+    bm->RangeMultiplier(16)->Range(16, 1 << 20);
+}
+
+BENCHMARK(bm_queue<int>)->Apply(common_args);
+BENCHMARK(bm_queue<order>)->Apply(common_args);
+BENCHMARK(bm_fill_drain<int>)->Apply(common_args);
+BENCHMARK(bm_fill_drain<order>)->Apply(common_args);
+BENCHMARK(bm_iterate<int>)->Apply(common_args);
+BENCHMARK(bm_iterate<order>)->Apply(common_args);
+
+BENCHMARK_MAIN();
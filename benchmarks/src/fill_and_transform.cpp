@@ -0,0 +1,99 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "skewed_allocator.hpp"
+
+using namespace std;
+
+template <class T>
+void bm_fill(benchmark::State& state) {
+    vector<T, not_highly_aligned_allocator<T>> v(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(v);
+        fill(v.begin(), v.end(), T{0x5A});
+        benchmark::DoNotOptimize(v);
+    }
+}
+
+template <class T>
+void bm_fill_n(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    vector<T, not_highly_aligned_allocator<T>> v(size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(v);
+        fill_n(v.begin(), size, T{0x5A});
+        benchmark::DoNotOptimize(v);
+    }
+}
+
+template <class T, class Fn>
+void bm_transform_unary(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    vector<T, not_highly_aligned_allocator<T>> src(size, T{0x5A});
+    vector<T, not_highly_aligned_allocator<T>> dest(size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(src);
+        transform(src.begin(), src.end(), dest.begin(), Fn{});
+        benchmark::DoNotOptimize(dest);
+    }
+}
+
+template <class T, class Fn>
+void bm_transform_binary(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    vector<T, not_highly_aligned_allocator<T>> src1(size, T{0x5A});
+    vector<T, not_highly_aligned_allocator<T>> src2(size, T{0x3C});
+    vector<T, not_highly_aligned_allocator<T>> dest(size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(src1);
+        benchmark::DoNotOptimize(src2);
+        transform(src1.begin(), src1.end(), src2.begin(), dest.begin(), Fn{});
+        benchmark::DoNotOptimize(dest);
+    }
+}
+
+void common_args(auto bm) {
+    bm->Arg(7)->Arg(18)->Arg(43)->Arg(131)->Arg(1000)->Arg(4096)->Arg(65536);
+}
+
+// fill() of 1-byte elements already uses memset.
+BENCHMARK(bm_fill<uint16_t>)->Apply(common_args);
+BENCHMARK(bm_fill<uint32_t>)->Apply(common_args);
+BENCHMARK(bm_fill<uint64_t>)->Apply(common_args);
+BENCHMARK(bm_fill<float>)->Apply(common_args);
+BENCHMARK(bm_fill<double>)->Apply(common_args);
+
+BENCHMARK(bm_fill_n<uint16_t>)->Apply(common_args);
+BENCHMARK(bm_fill_n<uint32_t>)->Apply(common_args);
+BENCHMARK(bm_fill_n<uint64_t>)->Apply(common_args);
+
+BENCHMARK(bm_transform_unary<int8_t, negate<int8_t>>)->Apply(common_args);
+BENCHMARK(bm_transform_unary<int16_t, negate<int16_t>>)->Apply(common_args);
+BENCHMARK(bm_transform_unary<int32_t, negate<>>)->Apply(common_args);
+BENCHMARK(bm_transform_unary<int64_t, negate<>>)->Apply(common_args);
+BENCHMARK(bm_transform_unary<float, negate<>>)->Apply(common_args);
+BENCHMARK(bm_transform_unary<double, negate<>>)->Apply(common_args);
+BENCHMARK(bm_transform_unary<uint32_t, bit_not<>>)->Apply(common_args);
+
+BENCHMARK(bm_transform_binary<uint8_t, plus<uint8_t>>)->Apply(common_args);
+BENCHMARK(bm_transform_binary<uint16_t, plus<uint16_t>>)->Apply(common_args);
+BENCHMARK(bm_transform_binary<uint32_t, plus<>>)->Apply(common_args);
+BENCHMARK(bm_transform_binary<uint64_t, plus<>>)->Apply(common_args);
+BENCHMARK(bm_transform_binary<float, plus<>>)->Apply(common_args);
+BENCHMARK(bm_transform_binary<double, plus<>>)->Apply(common_args);
+BENCHMARK(bm_transform_binary<uint32_t, minus<>>)->Apply(common_args);
+BENCHMARK(bm_transform_binary<uint8_t, bit_xor<uint8_t>>)->Apply(common_args);
+BENCHMARK(bm_transform_binary<uint64_t, bit_and<>>)->Apply(common_args);
+
+BENCHMARK_MAIN();
@@ -11,6 +11,7 @@
 #include <type_traits>
 #include <vector>
 
+#include "isa_level.hpp"
 #include "skewed_allocator.hpp"
 
 enum class Op {
@@ -58,6 +59,9 @@ void bm(benchmark::State& state) {
             benchmark::DoNotOptimize(a.rfind(T{'1'}));
         }
     }
+
+    const size_t scanned = Operation == Op::Count ? size : (pos < size ? pos + 1 : size);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(scanned * sizeof(T)));
 }
 
 void common_args(auto bm) {
@@ -91,4 +95,13 @@ BENCHMARK(bm<char32_t, not_highly_aligned_allocator, Op::StringRFind>)->Apply(co
 BENCHMARK(bm<uint64_t, not_highly_aligned_allocator, Op::FindSized>)->Apply(common_args);
 BENCHMARK(bm<uint64_t, not_highly_aligned_allocator, Op::Count>)->Apply(common_args);
 
+BENCHMARK_ISA_LEVELS(common_args, bm<uint8_t, not_highly_aligned_allocator, Op::FindSized>);
+BENCHMARK_ISA_LEVELS(common_args, bm<uint8_t, not_highly_aligned_allocator, Op::Count>);
+BENCHMARK_ISA_LEVELS(common_args, bm<uint16_t, not_highly_aligned_allocator, Op::FindSized>);
+BENCHMARK_ISA_LEVELS(common_args, bm<uint16_t, not_highly_aligned_allocator, Op::Count>);
+BENCHMARK_ISA_LEVELS(common_args, bm<uint32_t, not_highly_aligned_allocator, Op::FindSized>);
+BENCHMARK_ISA_LEVELS(common_args, bm<uint32_t, not_highly_aligned_allocator, Op::Count>);
+BENCHMARK_ISA_LEVELS(common_args, bm<uint64_t, not_highly_aligned_allocator, Op::FindSized>);
+BENCHMARK_ISA_LEVELS(common_args, bm<uint64_t, not_highly_aligned_allocator, Op::Count>);
+
 BENCHMARK_MAIN();
@@ -61,6 +61,51 @@ void bm(benchmark::State& state) {
     }
 }
 
+enum class NotOfType { str_member_first, str_member_last };
+
+template <NotOfType Alg, class T, T Start = T{'!'}>
+void bm_not_of(benchmark::State& state) {
+    const size_t Pos   = static_cast<size_t>(state.range(0));
+    const size_t NSize = static_cast<size_t>(state.range(1));
+    const size_t HSize = Pos * 2;
+
+    using container = basic_string<T, char_traits<T>, not_highly_aligned_allocator<T>>;
+
+    constexpr T HaystackOddOne{' '};
+    static_assert(HaystackOddOne < Start, "The following iota() should not produce the odd one out.");
+
+    container h(HSize, T{0});
+    container n(NSize, T{0});
+
+    if (NSize - 1 > static_cast<size_t>(numeric_limits<T>::max()) - static_cast<size_t>(Start)) {
+        puts("ERROR: The following iota() would overflow.");
+        abort();
+    }
+
+    iota(n.begin(), n.end(), Start);
+
+    if (Pos >= HSize) {
+        abort();
+    }
+
+    // Everything but h[Pos] is in the needle, like trimming a long run of whitespace.
+    for (size_t i = 0; i != HSize; ++i) {
+        h[i] = n[i % NSize];
+    }
+
+    h[Pos] = HaystackOddOne;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(h);
+        benchmark::DoNotOptimize(n);
+        if constexpr (Alg == NotOfType::str_member_first) {
+            benchmark::DoNotOptimize(h.find_first_not_of(n));
+        } else {
+            benchmark::DoNotOptimize(h.find_last_not_of(n));
+        }
+    }
+}
+
 void common_args(auto bm) {
     bm->Args({2, 3})->Args({6, 81})->Args({7, 4})->Args({9, 3})->Args({22, 5})->Args({58, 2});
     bm->Args({75, 85})->Args({102, 4})->Args({200, 46})->Args({325, 1})->Args({400, 50});
@@ -82,4 +127,12 @@ BENCHMARK(bm<AlgType::str_member_last, char>)->Apply(common_args);
 BENCHMARK(bm<AlgType::str_member_last, wchar_t>)->Apply(common_args);
 BENCHMARK(bm<AlgType::str_member_last, wchar_t, L'\x03B1'>)->Apply(common_args);
 
+BENCHMARK(bm_not_of<NotOfType::str_member_first, char>)->Apply(common_args);
+BENCHMARK(bm_not_of<NotOfType::str_member_first, wchar_t>)->Apply(common_args);
+BENCHMARK(bm_not_of<NotOfType::str_member_first, wchar_t, L'\x03B1'>)->Apply(common_args);
+
+BENCHMARK(bm_not_of<NotOfType::str_member_last, char>)->Apply(common_args);
+BENCHMARK(bm_not_of<NotOfType::str_member_last, wchar_t>)->Apply(common_args);
+BENCHMARK(bm_not_of<NotOfType::str_member_last, wchar_t, L'\x03B1'>)->Apply(common_args);
+
 BENCHMARK_MAIN();
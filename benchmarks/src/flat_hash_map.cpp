@@ -0,0 +1,119 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "utility.hpp"
+
+using namespace std;
+
+template <class Map>
+void bm_find_hit(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto keys = random_vector<uint64_t>(size);
+    Map map;
+    for (const auto& key : keys) {
+        map.emplace(key, key);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map);
+        uint64_t sum = 0;
+        for (const auto& key : keys) {
+            sum += map.find(key)->second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+template <class Map>
+void bm_find_miss(benchmark::State& state) {
+    const auto size   = static_cast<size_t>(state.range(0));
+    const auto keys   = random_vector<uint64_t>(size);
+    const auto probes = random_vector<uint64_t>(size); // 64-bit random keys, almost surely absent
+    Map map;
+    for (const auto& key : keys) {
+        map.emplace(key, key);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map);
+        size_t found = 0;
+        for (const auto& probe : probes) {
+            found += map.count(probe);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+template <class Map>
+void bm_insert_erase(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto keys = random_vector<uint64_t>(size);
+
+    for (auto _ : state) {
+        Map map;
+        for (const auto& key : keys) {
+            map.emplace(key, key);
+        }
+        for (const auto& key : keys) {
+            map.erase(key);
+        }
+        benchmark::DoNotOptimize(map);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+template <class Map>
+void bm_string_find(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    vector<string> keys;
+    keys.reserve(size);
+    for (const auto& val : random_vector<uint32_t>(size)) {
+        keys.push_back("key_" + to_string(val));
+    }
+
+    Map map;
+    for (const auto& key : keys) {
+        map.emplace(key, key.size());
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map);
+        size_t sum = 0;
+        for (const auto& key : keys) {
+            sum += map.find(key)->second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+void common_args(auto bm) {
+    bm->RangeMultiplier(16)->Range(16, 1 << 20);
+}
+
+using node_map  = unordered_map<uint64_t, uint64_t>;
+using flat_hash = stdext::flat_hash_map<uint64_t, uint64_t>;
+
+BENCHMARK(bm_find_hit<node_map>)->Apply(common_args);
+BENCHMARK(bm_find_hit<flat_hash>)->Apply(common_args);
+BENCHMARK(bm_find_miss<node_map>)->Apply(common_args);
+BENCHMARK(bm_find_miss<flat_hash>)->Apply(common_args);
+BENCHMARK(bm_insert_erase<node_map>)->Apply(common_args);
+BENCHMARK(bm_insert_erase<flat_hash>)->Apply(common_args);
+BENCHMARK(bm_string_find<unordered_map<string, size_t>>)->Apply(common_args);
+BENCHMARK(bm_string_find<stdext::flat_hash_map<string, size_t>>)->Apply(common_args);
+
+BENCHMARK_MAIN();
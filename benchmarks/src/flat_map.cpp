@@ -0,0 +1,175 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <flat_map>
+#include <flat_set>
+#include <map>
+#include <set>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "utility.hpp"
+
+using namespace std;
+
+template <class Container>
+Container make_container(const vector<uint32_t>& keys) {
+    if constexpr (requires { typename Container::mapped_type; }) {
+        Container map;
+        for (const auto& key : keys) {
+            map.emplace(key, key);
+        }
+        return map;
+    } else {
+        return Container(keys.begin(), keys.end());
+    }
+}
+
+template <class Container>
+void bm_find(benchmark::State& state) {
+    const auto size   = static_cast<size_t>(state.range(0));
+    const auto keys   = random_vector<uint32_t>(size);
+    const auto probes = random_vector<uint32_t>(size); // mostly misses, so that the whole search path is measured
+    const auto cont   = make_container<Container>(keys);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cont);
+        size_t found = 0;
+        for (const auto& key : keys) {
+            found += cont.find(key) != cont.end();
+        }
+        for (const auto& probe : probes) {
+            found += cont.contains(probe);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size * 2));
+}
+
+template <class Map>
+void bm_map_iterate(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto map  = make_container<Map>(random_vector<uint32_t>(size));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map);
+        uint64_t sum = 0;
+        for (const auto& [key, val] : map) {
+            sum += key ^ val;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+template <class Set>
+void bm_set_iterate(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto set  = make_container<Set>(random_vector<uint32_t>(size));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(set);
+        uint64_t sum = 0;
+        for (const auto& key : set) {
+            sum += key;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+template <class Map>
+void bm_map_bulk_build(benchmark::State& state) {
+    // half of the elements are already present; the other half arrive unsorted in one range insertion
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto keys = random_vector<uint32_t>(size);
+    const auto half = keys.begin() + static_cast<ptrdiff_t>(size / 2);
+    vector<pair<uint32_t, uint32_t>> elems;
+    for (auto it = half; it != keys.end(); ++it) {
+        elems.emplace_back(*it, *it);
+    }
+    const auto initial = make_container<Map>(vector<uint32_t>(keys.begin(), half));
+
+    for (auto _ : state) {
+        Map map = initial;
+        map.insert(elems.begin(), elems.end());
+        benchmark::DoNotOptimize(map);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * elems.size()));
+}
+
+template <class Set>
+void bm_set_bulk_build(benchmark::State& state) {
+    const auto size    = static_cast<size_t>(state.range(0));
+    const auto keys    = random_vector<uint32_t>(size);
+    const auto half    = keys.begin() + static_cast<ptrdiff_t>(size / 2);
+    const auto initial = Set(keys.begin(), half);
+
+    for (auto _ : state) {
+        Set set = initial;
+        set.insert(half, keys.end());
+        benchmark::DoNotOptimize(set);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * (size - size / 2)));
+}
+
+template <class Set>
+void bm_set_sorted_build(benchmark::State& state) {
+    // sorted_unique skips sorting the new elements; only the merge into the existing ones remains
+    const auto size = static_cast<size_t>(state.range(0));
+    auto keys       = random_vector<uint32_t>(size);
+    const auto half = keys.begin() + static_cast<ptrdiff_t>(size / 2);
+    sort(half, keys.end());
+    keys.erase(unique(half, keys.end()), keys.end());
+    const auto initial = Set(keys.begin(), half);
+
+    for (auto _ : state) {
+        Set set = initial;
+        if constexpr (is_same_v<Set, flat_set<uint32_t>>) {
+            set.insert(sorted_unique, half, keys.end());
+        } else {
+            set.insert(half, keys.end());
+        }
+        benchmark::DoNotOptimize(set);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * (keys.end() - half)));
+}
+
+void common_args(auto bm) {
+    bm->RangeMultiplier(16)->Range(16, 1 << 20);
+}
+
+using node_map = map<uint32_t, uint32_t>;
+using flat     = flat_map<uint32_t, uint32_t>;
+using node_set = set<uint32_t>;
+using flat_s   = flat_set<uint32_t>;
+
+BENCHMARK(bm_find<node_map>)->Apply(common_args);
+BENCHMARK(bm_find<flat>)->Apply(common_args);
+BENCHMARK(bm_find<node_set>)->Apply(common_args);
+BENCHMARK(bm_find<flat_s>)->Apply(common_args);
+
+BENCHMARK(bm_map_iterate<node_map>)->Apply(common_args);
+BENCHMARK(bm_map_iterate<flat>)->Apply(common_args);
+BENCHMARK(bm_set_iterate<node_set>)->Apply(common_args);
+BENCHMARK(bm_set_iterate<flat_s>)->Apply(common_args);
+
+BENCHMARK(bm_map_bulk_build<node_map>)->Apply(common_args);
+BENCHMARK(bm_map_bulk_build<flat>)->Apply(common_args);
+BENCHMARK(bm_set_bulk_build<node_set>)->Apply(common_args);
+BENCHMARK(bm_set_bulk_build<flat_s>)->Apply(common_args);
+BENCHMARK(bm_set_sorted_build<node_set>)->Apply(common_args);
+BENCHMARK(bm_set_sorted_build<flat_s>)->Apply(common_args);
+
+BENCHMARK_MAIN();
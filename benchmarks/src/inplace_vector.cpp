@@ -0,0 +1,95 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <inplace_vector>
+#include <vector>
+
+#include "utility.hpp"
+
+using namespace std;
+
+template <size_t N>
+struct hand_rolled { // the fixed array plus size counter that inplace_vector replaces
+    uint32_t elems[N];
+    size_t count = 0;
+
+    void push_back(const uint32_t val) noexcept {
+        elems[count++] = val;
+    }
+};
+
+enum class push_kind { vector_push_back, vector_reserved, hand_rolled, push_back, try_push_back, unchecked_push_back };
+
+template <push_kind Kind, size_t N>
+void bm_fill(benchmark::State& state) {
+    // builds a fresh container of N elements per iteration, as a request struct would
+    const auto src = random_vector<uint32_t>(N);
+
+    for (auto _ : state) {
+        if constexpr (Kind == push_kind::vector_push_back || Kind == push_kind::vector_reserved) {
+            vector<uint32_t> cont;
+            if constexpr (Kind == push_kind::vector_reserved) {
+                cont.reserve(N);
+            }
+            for (const auto& val : src) {
+                cont.push_back(val);
+            }
+            benchmark::DoNotOptimize(cont.data());
+        } else if constexpr (Kind == push_kind::hand_rolled) {
+            hand_rolled<N> cont;
+            for (const auto& val : src) {
+                cont.push_back(val);
+            }
+            benchmark::DoNotOptimize(cont);
+        } else {
+            inplace_vector<uint32_t, N> cont;
+            for (const auto& val : src) {
+                if constexpr (Kind == push_kind::push_back) {
+                    cont.push_back(val);
+                } else if constexpr (Kind == push_kind::try_push_back) {
+                    benchmark::DoNotOptimize(cont.try_push_back(val));
+                } else {
+                    cont.unchecked_push_back(val);
+                }
+            }
+            benchmark::DoNotOptimize(cont);
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * N));
+}
+
+template <class Container>
+void bm_copy(benchmark::State& state) {
+    // copies a full container; inplace_vector of a trivially copyable type is trivially copyable, vector allocates
+    const auto src    = random_vector<uint32_t>(64);
+    const Container c = Container(src.begin(), src.end());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(c);
+        Container copy = c;
+        benchmark::DoNotOptimize(copy);
+    }
+}
+
+BENCHMARK(bm_fill<push_kind::vector_push_back, 16>);
+BENCHMARK(bm_fill<push_kind::vector_reserved, 16>);
+BENCHMARK(bm_fill<push_kind::hand_rolled, 16>);
+BENCHMARK(bm_fill<push_kind::push_back, 16>);
+BENCHMARK(bm_fill<push_kind::try_push_back, 16>);
+BENCHMARK(bm_fill<push_kind::unchecked_push_back, 16>);
+
+BENCHMARK(bm_fill<push_kind::vector_push_back, 256>);
+BENCHMARK(bm_fill<push_kind::vector_reserved, 256>);
+BENCHMARK(bm_fill<push_kind::hand_rolled, 256>);
+BENCHMARK(bm_fill<push_kind::push_back, 256>);
+BENCHMARK(bm_fill<push_kind::try_push_back, 256>);
+BENCHMARK(bm_fill<push_kind::unchecked_push_back, 256>);
+
+BENCHMARK(bm_copy<vector<uint32_t>>);
+BENCHMARK(bm_copy<inplace_vector<uint32_t, 64>>);
+
+BENCHMARK_MAIN();
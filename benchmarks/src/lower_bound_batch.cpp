@@ -0,0 +1,77 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "utility.hpp"
+
+using namespace std;
+
+constexpr size_t key_count = 1 << 16;
+
+struct user_less { // not recognized by the vectorized path, so measures the interleaved scalar searches
+    template <class T>
+    bool operator()(const T& lhs, const T& rhs) const {
+        return lhs < rhs;
+    }
+};
+
+template <class T>
+vector<T> sorted_haystack(const size_t size) {
+    auto haystack = random_vector<T>(size);
+    sort(haystack.begin(), haystack.end());
+    return haystack;
+}
+
+template <class T>
+void bm_lower_bound_loop(benchmark::State& state) {
+    const auto haystack = sorted_haystack<T>(static_cast<size_t>(state.range(0)));
+    const auto keys     = random_vector<T>(key_count);
+    vector<ptrdiff_t> positions(key_count);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(haystack);
+        benchmark::DoNotOptimize(keys);
+        for (size_t i = 0; i != key_count; ++i) {
+            positions[i] = lower_bound(haystack.begin(), haystack.end(), keys[i]) - haystack.begin();
+        }
+        benchmark::DoNotOptimize(positions);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * key_count));
+}
+
+template <class T, class Pred>
+void bm_lower_bound_batch(benchmark::State& state) {
+    const auto haystack = sorted_haystack<T>(static_cast<size_t>(state.range(0)));
+    const auto keys     = random_vector<T>(key_count);
+    vector<ptrdiff_t> positions(key_count);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(haystack);
+        benchmark::DoNotOptimize(keys);
+        stdext::lower_bound_batch(
+            haystack.begin(), haystack.end(), keys.begin(), keys.end(), positions.begin(), Pred{});
+        benchmark::DoNotOptimize(positions);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * key_count));
+}
+
+// The largest haystacks are far bigger than the L2 cache, where the searches are bound by memory latency.
+void common_args(auto bm) {
+    bm->RangeMultiplier(16)->Range(16, 1 << 24);
+}
+
+BENCHMARK(bm_lower_bound_loop<uint32_t>)->Apply(common_args);
+BENCHMARK(bm_lower_bound_batch<uint32_t, less<>>)->Apply(common_args);
+BENCHMARK(bm_lower_bound_loop<int32_t>)->Apply(common_args);
+BENCHMARK(bm_lower_bound_batch<int32_t, less<>>)->Apply(common_args);
+BENCHMARK(bm_lower_bound_batch<uint32_t, user_less>)->Apply(common_args);
+
+BENCHMARK_MAIN();
@@ -10,6 +10,8 @@
 #include <type_traits>
 #include <vector>
 
+#include "isa_level.hpp"
+
 enum class Op {
     Min,
     Max,
@@ -52,6 +54,8 @@ void bm(benchmark::State& state) {
             benchmark::DoNotOptimize(ranges::minmax(a));
         }
     }
+
+    state.SetBytesProcessed(state.iterations() * state.range() * static_cast<int64_t>(sizeof(T)));
 }
 
 template <size_t ElementSize>
@@ -131,4 +135,17 @@ BENCHMARK(bm<double, Op::Min_val>)->Apply(common_arg<8>);
 BENCHMARK(bm<double, Op::Max_val>)->Apply(common_arg<8>);
 BENCHMARK(bm<double, Op::Both_val>)->Apply(common_arg<8>);
 
+BENCHMARK_ISA_LEVELS(common_arg<1>, bm<uint8_t, Op::Both>);
+BENCHMARK_ISA_LEVELS(common_arg<1>, bm<uint8_t, Op::Both_val>);
+BENCHMARK_ISA_LEVELS(common_arg<2>, bm<uint16_t, Op::Both>);
+BENCHMARK_ISA_LEVELS(common_arg<2>, bm<uint16_t, Op::Both_val>);
+BENCHMARK_ISA_LEVELS(common_arg<4>, bm<uint32_t, Op::Both>);
+BENCHMARK_ISA_LEVELS(common_arg<4>, bm<uint32_t, Op::Both_val>);
+BENCHMARK_ISA_LEVELS(common_arg<8>, bm<uint64_t, Op::Both>);
+BENCHMARK_ISA_LEVELS(common_arg<8>, bm<uint64_t, Op::Both_val>);
+BENCHMARK_ISA_LEVELS(common_arg<4>, bm<float, Op::Both>);
+BENCHMARK_ISA_LEVELS(common_arg<4>, bm<float, Op::Both_val>);
+BENCHMARK_ISA_LEVELS(common_arg<8>, bm<double, Op::Both>);
+BENCHMARK_ISA_LEVELS(common_arg<8>, bm<double, Op::Both_val>);
+
 BENCHMARK_MAIN();
@@ -6,8 +6,12 @@
 #include <cstddef>
 #include <cstdint>
 #include <ranges>
+#include <string>
+#include <type_traits>
 #include <vector>
 
+#include "isa_level.hpp"
+
 using namespace std;
 
 constexpr int64_t no_pos = -1;
@@ -15,12 +19,16 @@ constexpr int64_t no_pos = -1;
 enum class op {
     mismatch,
     lexi,
+    lexi_3way,
+    str_compare,
 };
 
 template <class T, op Op>
 void bm(benchmark::State& state) {
-    vector<T> a(static_cast<size_t>(state.range(0)), T{'.'});
-    vector<T> b(static_cast<size_t>(state.range(0)), T{'.'});
+    using container = conditional_t<Op == op::str_compare, basic_string<T>, vector<T>>;
+
+    container a(static_cast<size_t>(state.range(0)), T{'.'});
+    container b(static_cast<size_t>(state.range(0)), T{'.'});
 
     if (state.range(1) != no_pos) {
         b.at(static_cast<size_t>(state.range(1))) = 'x';
@@ -31,8 +39,15 @@ void bm(benchmark::State& state) {
             benchmark::DoNotOptimize(ranges::mismatch(a, b));
         } else if constexpr (Op == op::lexi) {
             benchmark::DoNotOptimize(ranges::lexicographical_compare(a, b));
+        } else if constexpr (Op == op::lexi_3way) {
+            benchmark::DoNotOptimize(lexicographical_compare_three_way(a.begin(), a.end(), b.begin(), b.end()));
+        } else if constexpr (Op == op::str_compare) {
+            benchmark::DoNotOptimize(a.compare(b));
         }
     }
+
+    const auto compared = state.range(1) != no_pos ? state.range(1) + 1 : state.range(0);
+    state.SetBytesProcessed(state.iterations() * 2 * compared * static_cast<int64_t>(sizeof(T)));
 }
 
 void common_args(auto bm) {
@@ -44,10 +59,25 @@ BENCHMARK(bm<uint16_t, op::mismatch>)->Apply(common_args);
 BENCHMARK(bm<uint32_t, op::mismatch>)->Apply(common_args);
 BENCHMARK(bm<uint64_t, op::mismatch>)->Apply(common_args);
 
+BENCHMARK_ISA_LEVELS(common_args, bm<uint8_t, op::mismatch>);
+BENCHMARK_ISA_LEVELS(common_args, bm<uint16_t, op::mismatch>);
+BENCHMARK_ISA_LEVELS(common_args, bm<uint32_t, op::mismatch>);
+BENCHMARK_ISA_LEVELS(common_args, bm<uint64_t, op::mismatch>);
+
 BENCHMARK(bm<uint8_t, op::lexi>)->Apply(common_args); // still optimized without vector algorithms using memcmp
 BENCHMARK(bm<int8_t, op::lexi>)->Apply(common_args); // optimized with vector algorithms only
 BENCHMARK(bm<uint16_t, op::lexi>)->Apply(common_args);
 BENCHMARK(bm<uint32_t, op::lexi>)->Apply(common_args);
 BENCHMARK(bm<uint64_t, op::lexi>)->Apply(common_args);
 
+BENCHMARK(bm<int16_t, op::lexi_3way>)->Apply(common_args);
+BENCHMARK(bm<int32_t, op::lexi_3way>)->Apply(common_args);
+BENCHMARK(bm<int64_t, op::lexi_3way>)->Apply(common_args);
+
+BENCHMARK(bm<char16_t, op::str_compare>)->Apply(common_args); // wmemcmp without vector algorithms
+BENCHMARK(bm<wchar_t, op::str_compare>)->Apply(common_args);
+BENCHMARK(bm<char32_t, op::str_compare>)->Apply(common_args); // element-wise loop without vector algorithms
+
+BENCHMARK_ISA_LEVELS(common_args, bm<char16_t, op::str_compare>);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,50 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <vector>
+
+#include "utility.hpp"
+
+// Sorts state.range(0) independent buckets of state.range(1) elements each. OuterPolicy walks the buckets and
+// InnerPolicy sorts each one, so <parallel_policy, parallel_policy> is the nested case: the inner sorts should share
+// the threads left over by the outer for_each rather than each queueing hardware_concurrency() worth of chunks.
+template <class OuterPolicy, class InnerPolicy>
+void bm_nested_sort(benchmark::State& state) {
+    const auto buckets     = static_cast<size_t>(state.range(0));
+    const auto bucket_size = static_cast<size_t>(state.range(1));
+    std::vector<std::vector<std::uint32_t>> src(buckets);
+    for (auto& bucket : src) {
+        bucket = random_vector<std::uint32_t>(bucket_size);
+    }
+
+    std::vector<std::vector<std::uint32_t>> v;
+    for (auto _ : state) {
+        state.PauseTiming();
+        v = src;
+        state.ResumeTiming();
+        std::for_each(OuterPolicy{}, v.begin(), v.end(),
+            [](std::vector<std::uint32_t>& bucket) { std::sort(InnerPolicy{}, bucket.begin(), bucket.end()); });
+        benchmark::DoNotOptimize(v);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0) * state.range(1));
+}
+
+void common_args(auto bm) {
+    // few large buckets leave most of the machine to the inner sorts; many small ones leave none
+    bm->ArgPair(2, 1 << 22)->ArgPair(8, 1 << 20)->ArgPair(64, 1 << 17)->ArgPair(1024, 1 << 13)->UseRealTime();
+}
+
+using std::execution::parallel_policy;
+using std::execution::sequenced_policy;
+
+BENCHMARK(bm_nested_sort<sequenced_policy, parallel_policy>)->Apply(common_args);
+BENCHMARK(bm_nested_sort<parallel_policy, sequenced_policy>)->Apply(common_args);
+BENCHMARK(bm_nested_sort<parallel_policy, parallel_policy>)->Apply(common_args);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,101 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <type_traits>
+#include <vector>
+
+#include "udt.hpp"
+#include "utility.hpp"
+
+template <class T>
+bool key_less(const T& lhs, const T& rhs) {
+    if constexpr (std::is_same_v<T, non_trivial<std::uint64_t>>) {
+        return lhs.c < rhs.c;
+    } else {
+        return lhs < rhs;
+    }
+}
+
+template <class T>
+std::vector<T> random_keys(const size_t n) {
+    const auto raw = random_vector<std::uint64_t>(n);
+    return std::vector<T>(raw.begin(), raw.end());
+}
+
+// seq takes the serial _Partition_by_median_guess_unchecked path, par the parallel sample-select
+template <class T, class ExPo>
+void bm_nth_element(benchmark::State& state) {
+    const auto n   = static_cast<size_t>(state.range(0));
+    const auto src = random_keys<T>(n);
+    std::vector<T> v;
+    for (auto _ : state) {
+        state.PauseTiming();
+        v = src;
+        state.ResumeTiming();
+        std::nth_element(ExPo{}, v.begin(), v.begin() + static_cast<std::ptrdiff_t>(n / 2), v.end(), key_less<T>);
+        benchmark::DoNotOptimize(v);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+template <class T, class ExPo>
+void bm_partial_sort(benchmark::State& state) {
+    const auto n   = static_cast<size_t>(state.range(0));
+    const auto src = random_keys<T>(n);
+    std::vector<T> v;
+    for (auto _ : state) {
+        state.PauseTiming();
+        v = src;
+        state.ResumeTiming();
+        std::partial_sort(ExPo{}, v.begin(), v.begin() + static_cast<std::ptrdiff_t>(n / 100), v.end(), key_less<T>);
+        benchmark::DoNotOptimize(v);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+template <class T, class ExPo>
+void bm_partial_sort_copy(benchmark::State& state) {
+    const auto n   = static_cast<size_t>(state.range(0));
+    const auto src = random_keys<T>(n);
+    std::vector<T> dest(n / 100);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(src);
+        std::partial_sort_copy(ExPo{}, src.begin(), src.end(), dest.begin(), dest.end(), key_less<T>);
+        benchmark::DoNotOptimize(dest);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+void common_args(auto bm) {
+    bm->RangeMultiplier(16)->Range(1 << 12, 1 << 24)->UseRealTime();
+}
+
+using std::execution::parallel_policy;
+using std::execution::sequenced_policy;
+
+BENCHMARK(bm_nth_element<std::uint32_t, sequenced_policy>)->Apply(common_args);
+BENCHMARK(bm_nth_element<std::uint32_t, parallel_policy>)->Apply(common_args);
+BENCHMARK(bm_nth_element<std::uint64_t, sequenced_policy>)->Apply(common_args);
+BENCHMARK(bm_nth_element<std::uint64_t, parallel_policy>)->Apply(common_args);
+BENCHMARK(bm_nth_element<non_trivial<std::uint64_t>, sequenced_policy>)->Apply(common_args);
+BENCHMARK(bm_nth_element<non_trivial<std::uint64_t>, parallel_policy>)->Apply(common_args);
+
+BENCHMARK(bm_partial_sort<std::uint32_t, sequenced_policy>)->Apply(common_args);
+BENCHMARK(bm_partial_sort<std::uint32_t, parallel_policy>)->Apply(common_args);
+BENCHMARK(bm_partial_sort<std::uint64_t, sequenced_policy>)->Apply(common_args);
+BENCHMARK(bm_partial_sort<std::uint64_t, parallel_policy>)->Apply(common_args);
+
+BENCHMARK(bm_partial_sort_copy<std::uint32_t, sequenced_policy>)->Apply(common_args);
+BENCHMARK(bm_partial_sort_copy<std::uint32_t, parallel_policy>)->Apply(common_args);
+BENCHMARK(bm_partial_sort_copy<std::uint64_t, sequenced_policy>)->Apply(common_args);
+BENCHMARK(bm_partial_sort_copy<std::uint64_t, parallel_policy>)->Apply(common_args);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,76 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <functional>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+using lcg64 = linear_congruential_engine<uint64_t, 6364136223846793005ULL, 1442695040888963407ULL, 0>;
+
+template <class Engine>
+void bm_generate_serial(benchmark::State& state) {
+    // the baseline that generate(par, ...) has to beat: one engine, called in order
+    vector<typename Engine::result_type> v(static_cast<size_t>(state.range(0)));
+    Engine eng;
+    for (auto _ : state) {
+        generate(v.begin(), v.end(), ref(eng));
+        benchmark::DoNotOptimize(v.data());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+template <class Engine>
+void bm_generate_splittable(benchmark::State& state) {
+    // same output as bm_generate_serial; each chunk jumps its own copy of the engine ahead with discard()
+    vector<typename Engine::result_type> v(static_cast<size_t>(state.range(0)));
+    Engine eng;
+    for (auto _ : state) {
+        generate(execution::par, v.begin(), v.end(), stdext::splittable_generator{eng});
+        benchmark::DoNotOptimize(v.data());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+template <class Engine>
+void bm_generate_n_splittable(benchmark::State& state) {
+    vector<typename Engine::result_type> v(static_cast<size_t>(state.range(0)));
+    Engine eng;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(generate_n(execution::par, v.begin(), v.size(), stdext::splittable_generator{eng}));
+        benchmark::DoNotOptimize(v.data());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void bm_generate_stateless(benchmark::State& state) {
+    vector<uint64_t> v(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        generate(execution::par, v.begin(), v.end(), stdext::stateless_generator{[] { return uint64_t{0x5A}; }});
+        benchmark::DoNotOptimize(v.data());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void common_args(auto bm) {
+    bm->RangeMultiplier(16)->Range(1 << 12, 1 << 24)->UseRealTime();
+}
+
+BENCHMARK(bm_generate_serial<minstd_rand>)->Apply(common_args);
+BENCHMARK(bm_generate_splittable<minstd_rand>)->Apply(common_args);
+BENCHMARK(bm_generate_serial<lcg64>)->Apply(common_args);
+BENCHMARK(bm_generate_splittable<lcg64>)->Apply(common_args);
+BENCHMARK(bm_generate_n_splittable<lcg64>)->Apply(common_args);
+BENCHMARK(bm_generate_stateless)->Apply(common_args);
+
+BENCHMARK_MAIN();
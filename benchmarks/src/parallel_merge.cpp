@@ -0,0 +1,107 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "udt.hpp"
+#include "utility.hpp"
+
+struct heavy_key {
+    std::uint64_t key;
+    std::string payload;
+
+    heavy_key() = default;
+    heavy_key(const std::uint64_t k) : key(k), payload(48, static_cast<char>('a' + k % 26)) {}
+};
+
+template <class T>
+bool key_less(const T& lhs, const T& rhs) {
+    if constexpr (std::is_same_v<T, heavy_key>) {
+        return lhs.key < rhs.key;
+    } else if constexpr (std::is_same_v<T, non_trivial<std::uint64_t>>) {
+        return lhs.c < rhs.c;
+    } else {
+        return lhs < rhs;
+    }
+}
+
+template <class T>
+std::vector<T> sorted_keys(const size_t n) {
+    const auto raw = random_vector<std::uint64_t>(n);
+    std::vector<T> res(raw.begin(), raw.end());
+    std::sort(res.begin(), res.end(), key_less<T>);
+    return res;
+}
+
+template <class T, class ExPo>
+void bm_merge(benchmark::State& state) {
+    const auto n     = static_cast<size_t>(state.range(0));
+    const auto left  = sorted_keys<T>(n / 2);
+    const auto right = sorted_keys<T>(n - n / 2);
+    std::vector<T> dest(n);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(left);
+        benchmark::DoNotOptimize(right);
+        std::merge(ExPo{}, left.begin(), left.end(), right.begin(), right.end(), dest.begin(), key_less<T>);
+        benchmark::DoNotOptimize(dest);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+template <class T, class ExPo>
+void bm_inplace_merge(benchmark::State& state) {
+    const auto n     = static_cast<size_t>(state.range(0));
+    const auto left  = sorted_keys<T>(n / 2);
+    const auto right = sorted_keys<T>(n - n / 2);
+    std::vector<T> src(left.begin(), left.end());
+    src.insert(src.end(), right.begin(), right.end());
+    std::vector<T> v;
+    for (auto _ : state) {
+        state.PauseTiming();
+        v = src;
+        state.ResumeTiming();
+        std::inplace_merge(ExPo{}, v.begin(), v.begin() + static_cast<std::ptrdiff_t>(n / 2), v.end(), key_less<T>);
+        benchmark::DoNotOptimize(v);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+void common_args(auto bm) {
+    bm->RangeMultiplier(16)->Range(1 << 10, 1 << 24)->UseRealTime();
+}
+
+void heavy_args(auto bm) {
+    bm->RangeMultiplier(16)->Range(1 << 10, 1 << 20)->UseRealTime();
+}
+
+using std::execution::parallel_policy;
+using std::execution::sequenced_policy;
+
+BENCHMARK(bm_merge<std::uint32_t, sequenced_policy>)->Apply(common_args);
+BENCHMARK(bm_merge<std::uint32_t, parallel_policy>)->Apply(common_args);
+BENCHMARK(bm_merge<std::uint64_t, sequenced_policy>)->Apply(common_args);
+BENCHMARK(bm_merge<std::uint64_t, parallel_policy>)->Apply(common_args);
+BENCHMARK(bm_merge<non_trivial<std::uint64_t>, sequenced_policy>)->Apply(common_args);
+BENCHMARK(bm_merge<non_trivial<std::uint64_t>, parallel_policy>)->Apply(common_args);
+BENCHMARK(bm_merge<heavy_key, sequenced_policy>)->Apply(heavy_args);
+BENCHMARK(bm_merge<heavy_key, parallel_policy>)->Apply(heavy_args);
+
+BENCHMARK(bm_inplace_merge<std::uint32_t, sequenced_policy>)->Apply(common_args);
+BENCHMARK(bm_inplace_merge<std::uint32_t, parallel_policy>)->Apply(common_args);
+BENCHMARK(bm_inplace_merge<std::uint64_t, sequenced_policy>)->Apply(common_args);
+BENCHMARK(bm_inplace_merge<std::uint64_t, parallel_policy>)->Apply(common_args);
+BENCHMARK(bm_inplace_merge<non_trivial<std::uint64_t>, sequenced_policy>)->Apply(common_args);
+BENCHMARK(bm_inplace_merge<non_trivial<std::uint64_t>, parallel_policy>)->Apply(common_args);
+BENCHMARK(bm_inplace_merge<heavy_key, sequenced_policy>)->Apply(heavy_args);
+BENCHMARK(bm_inplace_merge<heavy_key, parallel_policy>)->Apply(heavy_args);
+
+BENCHMARK_MAIN();
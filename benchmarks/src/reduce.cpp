@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+#include "skewed_allocator.hpp"
+
+using namespace std;
+
+template <class T, class Fn>
+void bm_accumulate(benchmark::State& state) {
+    const vector<T, not_highly_aligned_allocator<T>> v(static_cast<size_t>(state.range(0)), T{0x5A});
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(v);
+        benchmark::DoNotOptimize(accumulate(v.begin(), v.end(), T{0}, Fn{}));
+    }
+}
+
+template <class T, class Fn>
+void bm_reduce(benchmark::State& state) {
+    const vector<T, not_highly_aligned_allocator<T>> v(static_cast<size_t>(state.range(0)), T{0x5A});
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(v);
+        benchmark::DoNotOptimize(reduce(v.begin(), v.end(), T{0}, Fn{}));
+    }
+}
+
+template <class T>
+void bm_reduce_unseq(benchmark::State& state) {
+    const vector<T, not_highly_aligned_allocator<T>> v(static_cast<size_t>(state.range(0)), T{0x5A});
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(v);
+        benchmark::DoNotOptimize(reduce(execution::unseq, v.begin(), v.end()));
+    }
+}
+
+void common_args(auto bm) {
+    bm->Arg(7)->Arg(18)->Arg(43)->Arg(131)->Arg(1000)->Arg(4096)->Arg(65536);
+}
+
+BENCHMARK(bm_accumulate<uint8_t, plus<>>)->Apply(common_args);
+BENCHMARK(bm_accumulate<uint16_t, plus<>>)->Apply(common_args);
+BENCHMARK(bm_accumulate<uint32_t, plus<>>)->Apply(common_args);
+BENCHMARK(bm_accumulate<uint64_t, plus<>>)->Apply(common_args);
+BENCHMARK(bm_accumulate<uint32_t, bit_xor<>>)->Apply(common_args);
+// accumulate() must add floating-point values in order, so this isn't vectorized.
+BENCHMARK(bm_accumulate<float, plus<>>)->Apply(common_args);
+
+BENCHMARK(bm_reduce<uint8_t, plus<>>)->Apply(common_args);
+BENCHMARK(bm_reduce<uint32_t, plus<>>)->Apply(common_args);
+BENCHMARK(bm_reduce<uint64_t, bit_or<>>)->Apply(common_args);
+BENCHMARK(bm_reduce<float, plus<>>)->Apply(common_args);
+BENCHMARK(bm_reduce<double, plus<>>)->Apply(common_args);
+
+BENCHMARK(bm_reduce_unseq<int32_t>)->Apply(common_args);
+BENCHMARK(bm_reduce_unseq<float>)->Apply(common_args);
+BENCHMARK(bm_reduce_unseq<double>)->Apply(common_args);
+
+BENCHMARK_MAIN();
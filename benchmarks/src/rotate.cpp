@@ -0,0 +1,57 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "skewed_allocator.hpp"
+
+using namespace std;
+
+template <class T, template <class> class Alloc>
+void std_rotate(benchmark::State& state) {
+    const auto size  = static_cast<size_t>(state.range(0));
+    const auto shift = static_cast<ptrdiff_t>(state.range(1));
+    vector<T, Alloc<T>> a(size, T{'a'});
+
+    for (auto _ : state) {
+        rotate(a.begin(), a.begin() + shift, a.end());
+        benchmark::DoNotOptimize(a);
+    }
+}
+
+template <class T, template <class> class Alloc>
+void std_shift_left(benchmark::State& state) {
+    const auto size  = static_cast<size_t>(state.range(0));
+    const auto shift = static_cast<ptrdiff_t>(state.range(1));
+    vector<T, Alloc<T>> a(size, T{'a'});
+
+    for (auto _ : state) {
+        shift_left(a.begin(), a.end(), shift);
+        benchmark::DoNotOptimize(a);
+    }
+}
+
+// Shifts by a few elements (as in compacting a ring buffer), by a fraction of the range, and by half of it.
+void common_args(auto bm) {
+    for (const long long size : {15, 125, 800, 3000, 9000, 65536, 1 << 20}) {
+        for (const long long shift : {1LL, 7LL, size / 3, size / 2}) {
+            if (shift < size) {
+                bm->Args({size, shift});
+            }
+        }
+    }
+}
+
+BENCHMARK(std_rotate<uint8_t, highly_aligned_allocator>)->Apply(common_args);
+BENCHMARK(std_rotate<uint8_t, not_highly_aligned_allocator>)->Apply(common_args);
+BENCHMARK(std_rotate<uint32_t, highly_aligned_allocator>)->Apply(common_args);
+BENCHMARK(std_rotate<uint32_t, not_highly_aligned_allocator>)->Apply(common_args);
+
+BENCHMARK(std_shift_left<uint8_t, not_highly_aligned_allocator>)->Apply(common_args);
+BENCHMARK(std_shift_left<uint32_t, not_highly_aligned_allocator>)->Apply(common_args);
+
+BENCHMARK_MAIN();
@@ -47,13 +47,18 @@ constexpr data_and_pattern patterns[] = {
 
     /* 4. Small, evil */ {fill_pattern_view<3000, false>, fill_pattern_view<7, true>},
     /* 5. Large, evil */ {fill_pattern_view<3000, false>, fill_pattern_view<20, true>},
+
+    /* 6. Long, closer to end   */ {lorem_ipsum, "Maecenas elit elit, condimentum vitae auctor a, cursus et"sv},
+    /* 7. Long, closer to begin */ {lorem_ipsum, "Quisque vel mauris pulvinar, pretium purus vel, ultricies erat"sv},
+    /* 8. Long, evil */ {fill_pattern_view<3000, false>, fill_pattern_view<60, true>},
 };
 
 template <class T>
 using not_highly_aligned_basic_string = std::basic_string<T, std::char_traits<T>, not_highly_aligned_allocator<T>>;
 
-using not_highly_aligned_string  = not_highly_aligned_basic_string<char>;
-using not_highly_aligned_wstring = not_highly_aligned_basic_string<wchar_t>;
+using not_highly_aligned_string    = not_highly_aligned_basic_string<char>;
+using not_highly_aligned_wstring   = not_highly_aligned_basic_string<wchar_t>;
+using not_highly_aligned_u32string = not_highly_aligned_basic_string<char32_t>;
 
 void c_strstr(benchmark::State& state) {
     const auto& src_haystack = patterns[static_cast<size_t>(state.range())].data;
@@ -118,6 +123,29 @@ void search_default_searcher(benchmark::State& state) {
     }
 }
 
+template <class T, T Offset>
+void boyer_moore_one_off(benchmark::State& state) {
+    // The searcher is constructed for each search, so its table build is measured too.
+    // A non-zero Offset moves the pattern out of the range the small table covers.
+    const auto& src_haystack = patterns[static_cast<size_t>(state.range())].data;
+    const auto& src_needle   = patterns[static_cast<size_t>(state.range())].pattern;
+
+    const auto widen = [](const char c) { return static_cast<T>(static_cast<T>(c) + Offset); };
+
+    std::vector<T, not_highly_aligned_allocator<T>> haystack(src_haystack.size());
+    std::vector<T, not_highly_aligned_allocator<T>> needle(src_needle.size());
+    std::transform(src_haystack.begin(), src_haystack.end(), haystack.begin(), widen);
+    std::transform(src_needle.begin(), src_needle.end(), needle.begin(), widen);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(haystack);
+        benchmark::DoNotOptimize(needle);
+        const std::boyer_moore_searcher searcher{needle.begin(), needle.end()};
+        auto res = std::search(haystack.begin(), haystack.end(), searcher);
+        benchmark::DoNotOptimize(res);
+    }
+}
+
 template <class T>
 void member_find(benchmark::State& state) {
     const auto& src_haystack = patterns[static_cast<size_t>(state.range())].data;
@@ -190,23 +218,37 @@ BENCHMARK(c_strstr)->Apply(common_args);
 
 BENCHMARK(classic_search<std::uint8_t>)->Apply(common_args);
 BENCHMARK(classic_search<std::uint16_t>)->Apply(common_args);
+BENCHMARK(classic_search<std::uint32_t>)->Apply(common_args);
+BENCHMARK(classic_search<std::uint64_t>)->Apply(common_args);
 
 BENCHMARK(ranges_search<std::uint8_t>)->Apply(common_args);
 BENCHMARK(ranges_search<std::uint16_t>)->Apply(common_args);
+BENCHMARK(ranges_search<std::uint32_t>)->Apply(common_args);
+BENCHMARK(ranges_search<std::uint64_t>)->Apply(common_args);
 
 BENCHMARK(search_default_searcher<std::uint8_t>)->Apply(common_args);
 BENCHMARK(search_default_searcher<std::uint16_t>)->Apply(common_args);
 
+BENCHMARK(boyer_moore_one_off<std::uint8_t, 0>)->Apply(common_args);
+BENCHMARK(boyer_moore_one_off<std::uint16_t, 0>)->Apply(common_args);
+BENCHMARK(boyer_moore_one_off<std::uint16_t, 0x100>)->Apply(common_args);
+
 BENCHMARK(member_find<not_highly_aligned_string>)->Apply(common_args);
 BENCHMARK(member_find<not_highly_aligned_wstring>)->Apply(common_args);
+BENCHMARK(member_find<not_highly_aligned_u32string>)->Apply(common_args);
 
 BENCHMARK(classic_find_end<std::uint8_t>)->Apply(common_args);
 BENCHMARK(classic_find_end<std::uint16_t>)->Apply(common_args);
+BENCHMARK(classic_find_end<std::uint32_t>)->Apply(common_args);
+BENCHMARK(classic_find_end<std::uint64_t>)->Apply(common_args);
 
 BENCHMARK(ranges_find_end<std::uint8_t>)->Apply(common_args);
 BENCHMARK(ranges_find_end<std::uint16_t>)->Apply(common_args);
+BENCHMARK(ranges_find_end<std::uint32_t>)->Apply(common_args);
+BENCHMARK(ranges_find_end<std::uint64_t>)->Apply(common_args);
 
 BENCHMARK(member_rfind<not_highly_aligned_string>)->Apply(common_args);
 BENCHMARK(member_rfind<not_highly_aligned_wstring>)->Apply(common_args);
+BENCHMARK(member_rfind<not_highly_aligned_u32string>)->Apply(common_args);
 
 BENCHMARK_MAIN();
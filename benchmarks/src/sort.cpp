@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "isa_level.hpp"
+
+enum class Dist {
+    Random,
+    Sorted,
+    Reversed,
+    Few_unique,
+};
+
+template <class T>
+std::vector<T> make_input(const size_t n, const Dist dist) {
+    std::mt19937_64 gen{1729};
+    std::vector<T> v(n);
+
+    if (dist == Dist::Few_unique) {
+        std::generate(v.begin(), v.end(), [&gen] { return static_cast<T>(gen() % 16); });
+    } else if constexpr (std::is_floating_point_v<T>) {
+        std::uniform_real_distribution<T> dis(T{-1'000'000}, T{1'000'000});
+        std::generate(v.begin(), v.end(), [&] { return dis(gen); });
+    } else {
+        std::generate(v.begin(), v.end(), [&gen] { return static_cast<T>(gen()); });
+    }
+
+    if (dist == Dist::Sorted) {
+        std::sort(v.begin(), v.end());
+    } else if (dist == Dist::Reversed) {
+        std::sort(v.begin(), v.end(), std::greater<>{});
+    }
+
+    return v;
+}
+
+template <class T, Dist dist, class Pr = std::less<>>
+void bm(benchmark::State& state) {
+    const auto src = make_input<T>(static_cast<size_t>(state.range(0)), dist);
+    std::vector<T> v;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        v = src;
+        state.ResumeTiming();
+        std::sort(v.begin(), v.end(), Pr{});
+        benchmark::DoNotOptimize(v);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+void common_args(auto bm) {
+    bm->Arg(100)->Arg(10'000)->Arg(1'000'000);
+}
+
+// sort() is vectorized for 4- and 8-byte integral and floating-point elements ordered by less or greater.
+BENCHMARK(bm<std::int32_t, Dist::Random>)->Apply(common_args);
+BENCHMARK(bm<std::int32_t, Dist::Sorted>)->Apply(common_args);
+BENCHMARK(bm<std::int32_t, Dist::Reversed>)->Apply(common_args);
+BENCHMARK(bm<std::int32_t, Dist::Few_unique>)->Apply(common_args);
+BENCHMARK(bm<std::int32_t, Dist::Random, std::greater<>>)->Apply(common_args);
+
+BENCHMARK(bm<std::uint64_t, Dist::Random>)->Apply(common_args);
+BENCHMARK(bm<std::uint64_t, Dist::Sorted>)->Apply(common_args);
+BENCHMARK(bm<std::uint64_t, Dist::Reversed>)->Apply(common_args);
+BENCHMARK(bm<std::uint64_t, Dist::Few_unique>)->Apply(common_args);
+
+BENCHMARK(bm<float, Dist::Random>)->Apply(common_args);
+BENCHMARK(bm<float, Dist::Sorted>)->Apply(common_args);
+BENCHMARK(bm<float, Dist::Few_unique>)->Apply(common_args);
+
+BENCHMARK(bm<double, Dist::Random>)->Apply(common_args);
+BENCHMARK(bm<double, Dist::Sorted>)->Apply(common_args);
+BENCHMARK(bm<double, Dist::Few_unique>)->Apply(common_args);
+
+BENCHMARK_ISA_LEVELS(common_args, bm<std::int32_t, Dist::Random>);
+BENCHMARK_ISA_LEVELS(common_args, bm<double, Dist::Random>);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,67 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <list>
+#include <memory_resource>
+#include <vector>
+
+using namespace std;
+
+pmr::synchronized_pool_resource shared_pool;
+
+pmr::memory_resource* get_resource(const bool use_pool) {
+    return use_pool ? static_cast<pmr::memory_resource*>(&shared_pool) : pmr::new_delete_resource();
+}
+
+// Every thread allocates and frees small blocks of mixed sizes, as node-based containers do.
+template <bool UsePool>
+void alloc_free(benchmark::State& state) {
+    const auto count                  = static_cast<size_t>(state.range(0));
+    pmr::memory_resource* const res   = get_resource(UsePool);
+    static constexpr size_t sizes[]   = {16, 24, 32, 48, 64, 96, 128, 256};
+    static constexpr size_t num_sizes = size(sizes);
+    vector<void*> ptrs(count);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            ptrs[i] = res->allocate(sizes[i % num_sizes], alignof(max_align_t));
+        }
+        benchmark::DoNotOptimize(ptrs.data());
+        for (size_t i = 0; i < count; ++i) {
+            res->deallocate(ptrs[i], sizes[i % num_sizes], alignof(max_align_t));
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+// Every thread fills and clears a pmr::list.
+template <bool UsePool>
+void list_push_clear(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    pmr::list<size_t> l{get_resource(UsePool)};
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            l.push_back(i);
+        }
+        benchmark::DoNotOptimize(l);
+        l.clear();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+void common_args(auto bm) {
+    bm->Arg(64)->Arg(1024)->ThreadRange(1, 32)->UseRealTime();
+}
+
+BENCHMARK(alloc_free<false>)->Apply(common_args);
+BENCHMARK(alloc_free<true>)->Apply(common_args);
+
+BENCHMARK(list_push_clear<false>)->Apply(common_args);
+BENCHMARK(list_push_clear<true>)->Apply(common_args);
+
+BENCHMARK_MAIN();
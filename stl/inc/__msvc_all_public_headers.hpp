@@ -85,6 +85,8 @@
 #include <exception>
 #include <expected>
 #include <filesystem>
+#include <flat_map>
+#include <flat_set>
 #include <format>
 #include <forward_list>
 #include <fstream>
@@ -92,6 +94,7 @@
 #include <generator>
 #include <hash_map>
 #include <hash_set>
+#include <inplace_vector>
 #include <iomanip>
 #include <ios>
 #include <iosfwd>
@@ -43,6 +43,16 @@ __declspec(noalias) size_t __stdcall __std_find_last_of_trivial_pos_1(
 __declspec(noalias) size_t __stdcall __std_find_last_of_trivial_pos_2(
     const void* _Haystack, size_t _Haystack_length, const void* _Needle, size_t _Needle_length) noexcept;
 
+__declspec(noalias) size_t __stdcall __std_find_first_not_of_trivial_pos_1(
+    const void* _Haystack, size_t _Haystack_length, const void* _Needle, size_t _Needle_length) noexcept;
+__declspec(noalias) size_t __stdcall __std_find_first_not_of_trivial_pos_2(
+    const void* _Haystack, size_t _Haystack_length, const void* _Needle, size_t _Needle_length) noexcept;
+
+__declspec(noalias) size_t __stdcall __std_find_last_not_of_trivial_pos_1(
+    const void* _Haystack, size_t _Haystack_length, const void* _Needle, size_t _Needle_length) noexcept;
+__declspec(noalias) size_t __stdcall __std_find_last_not_of_trivial_pos_2(
+    const void* _Haystack, size_t _Haystack_length, const void* _Needle, size_t _Needle_length) noexcept;
+
 } // extern "C"
 
 _STD_BEGIN
@@ -77,6 +87,32 @@ size_t _Find_last_of_pos_vectorized(const _Ty1* const _Haystack, const size_t _H
     }
 }
 
+template <class _Ty1, class _Ty2>
+size_t _Find_first_not_of_pos_vectorized(const _Ty1* const _Haystack, const size_t _Haystack_length,
+    const _Ty2* const _Needle, const size_t _Needle_length) noexcept {
+    _STL_INTERNAL_STATIC_ASSERT(sizeof(_Ty1) == sizeof(_Ty2));
+    if constexpr (sizeof(_Ty1) == 1) {
+        return ::__std_find_first_not_of_trivial_pos_1(_Haystack, _Haystack_length, _Needle, _Needle_length);
+    } else if constexpr (sizeof(_Ty1) == 2) {
+        return ::__std_find_first_not_of_trivial_pos_2(_Haystack, _Haystack_length, _Needle, _Needle_length);
+    } else {
+        _STL_INTERNAL_STATIC_ASSERT(false); // unexpected size
+    }
+}
+
+template <class _Ty1, class _Ty2>
+size_t _Find_last_not_of_pos_vectorized(const _Ty1* const _Haystack, const size_t _Haystack_length,
+    const _Ty2* const _Needle, const size_t _Needle_length) noexcept {
+    _STL_INTERNAL_STATIC_ASSERT(sizeof(_Ty1) == sizeof(_Ty2));
+    if constexpr (sizeof(_Ty1) == 1) {
+        return ::__std_find_last_not_of_trivial_pos_1(_Haystack, _Haystack_length, _Needle, _Needle_length);
+    } else if constexpr (sizeof(_Ty1) == 2) {
+        return ::__std_find_last_not_of_trivial_pos_2(_Haystack, _Haystack_length, _Needle, _Needle_length);
+    } else {
+        _STL_INTERNAL_STATIC_ASSERT(false); // unexpected size
+    }
+}
+
 _STD_END
 
 #endif // _USE_STD_VECTOR_ALGORITHMS
@@ -183,6 +219,22 @@ struct _Char_traits { // properties of a string or stream element
     _NODISCARD static _CONSTEXPR17 int compare(_In_reads_(_Count) const _Elem* _First1,
         _In_reads_(_Count) const _Elem* _First2, size_t _Count) noexcept /* strengthened */ {
         // compare [_First1, _First1 + _Count) with [_First2, ...)
+#if _USE_STD_VECTOR_ALGORITHMS
+        if constexpr (is_integral_v<_Elem> && sizeof(_Elem) != 1) {
+#if _HAS_CXX17
+            if (!_STD _Is_constant_evaluated())
+#endif // _HAS_CXX17
+            {
+                const size_t _Pos = _STD _Mismatch_vectorized<sizeof(_Elem)>(_First1, _First2, _Count);
+                if (_Pos == _Count) {
+                    return 0;
+                }
+
+                return _First1[_Pos] < _First2[_Pos] ? -1 : +1;
+            }
+        }
+#endif // _USE_STD_VECTOR_ALGORITHMS
+
         for (; 0 < _Count; --_Count, ++_First1, ++_First2) {
             if (*_First1 != *_First2) {
                 return *_First1 < *_First2 ? -1 : +1;
@@ -291,8 +343,17 @@ public:
         }
 #endif // _HAS_CXX17
 
+#if _USE_STD_VECTOR_ALGORITHMS
+        const size_t _Pos = _STD _Mismatch_vectorized<sizeof(_Elem)>(_First1, _First2, _Count);
+        if (_Pos == _Count) {
+            return 0;
+        }
+
+        return _First1[_Pos] < _First2[_Pos] ? -1 : +1;
+#else // ^^^ _USE_STD_VECTOR_ALGORITHMS / !_USE_STD_VECTOR_ALGORITHMS vvv
         return _CSTD wmemcmp(
             reinterpret_cast<const wchar_t*>(_First1), reinterpret_cast<const wchar_t*>(_First2), _Count);
+#endif // ^^^ !_USE_STD_VECTOR_ALGORITHMS ^^^
     }
 
     _NODISCARD static _CONSTEXPR17 size_t length(_In_z_ const _Elem* _First) noexcept /* strengthened */ {
@@ -655,7 +716,7 @@ constexpr size_t _Traits_find(_In_reads_(_Hay_size) const _Traits_ptr_t<_Traits>
     }
 
 #if _USE_STD_VECTOR_ALGORITHMS
-    if constexpr (_Is_implementation_handled_char_traits<_Traits> && sizeof(typename _Traits::char_type) <= 2) {
+    if constexpr (_Is_implementation_handled_char_traits<_Traits>) {
         if (!_STD _Is_constant_evaluated()) {
             const auto _End = _Haystack + _Hay_size;
             const auto _Ptr = _STD _Search_vectorized(_Haystack + _Start_at, _End, _Needle, _Needle_size);
@@ -729,7 +790,7 @@ constexpr size_t _Traits_rfind(_In_reads_(_Hay_size) const _Traits_ptr_t<_Traits
     const size_t _Actual_start_at = (_STD min)(_Start_at, _Hay_size - _Needle_size);
 
 #if _USE_STD_VECTOR_ALGORITHMS
-    if constexpr (_Is_implementation_handled_char_traits<_Traits> && sizeof(typename _Traits::char_type) <= 2) {
+    if constexpr (_Is_implementation_handled_char_traits<_Traits>) {
         if (!_STD _Is_constant_evaluated()) {
             // _Find_end_vectorized takes into account the needle length when locating the search start.
             // As a potentially earlier start position can be specified, we need to take it into account,
@@ -961,6 +1022,21 @@ constexpr size_t _Traits_find_first_not_of(_In_reads_(_Hay_size) const _Traits_p
 
     if constexpr (_Is_implementation_handled_char_traits<_Traits>) {
         using _Elem = typename _Traits::char_type;
+#if _USE_STD_VECTOR_ALGORITHMS
+        if constexpr (sizeof(_Elem) <= 2) {
+            if (!_STD _Is_constant_evaluated()) {
+                const size_t _Remaining_size = _Hay_size - _Start_at;
+                if (_Remaining_size + _Needle_size >= _Threshold_find_first_of) { // same threshold as find_first_of
+                    size_t _Pos = _Find_first_not_of_pos_vectorized(_Hay_start, _Remaining_size, _Needle, _Needle_size);
+                    if (_Pos != static_cast<size_t>(-1)) {
+                        _Pos += _Start_at;
+                    }
+                    return _Pos;
+                }
+            }
+        }
+#endif // _USE_STD_VECTOR_ALGORITHMS
+
         _String_bitmap<_Elem> _Matches;
         if (_Matches._Mark(_Needle, _Needle + _Needle_size)) {
             for (auto _Match_try = _Hay_start; _Match_try < _Hay_end; ++_Match_try) {
@@ -1012,6 +1088,17 @@ constexpr size_t _Traits_find_last_not_of(_In_reads_(_Hay_size) const _Traits_pt
 
     if constexpr (_Is_implementation_handled_char_traits<_Traits>) {
         using _Elem = typename _Traits::char_type;
+#if _USE_STD_VECTOR_ALGORITHMS
+        if constexpr (sizeof(_Elem) <= 2) {
+            if (!_STD _Is_constant_evaluated()) {
+                const size_t _Remaining_size = _Hay_start + 1;
+                if (_Remaining_size + _Needle_size >= _Threshold_find_first_of) { // same threshold for first/last
+                    return _Find_last_not_of_pos_vectorized(_Haystack, _Remaining_size, _Needle, _Needle_size);
+                }
+            }
+        }
+#endif // _USE_STD_VECTOR_ALGORITHMS
+
         _String_bitmap<_Elem> _Matches;
         if (_Matches._Mark(_Needle, _Needle + _Needle_size)) {
             for (auto _Match_try = _Haystack + _Hay_start;; --_Match_try) {
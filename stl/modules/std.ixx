@@ -64,6 +64,10 @@ export module std;
 #include <expected>
 #endif // _HAS_CXX23
 #include <filesystem>
+#if _HAS_CXX23
+#include <flat_map>
+#include <flat_set>
+#endif // _HAS_CXX23
 #include <format>
 #include <forward_list>
 #include <fstream>
@@ -73,6 +77,9 @@ export module std;
 #include <generator>
 #endif // _HAS_CXX23
 #include <initializer_list>
+#if _HAS_CXX23
+#include <inplace_vector>
+#endif // _HAS_CXX23
 #include <iomanip>
 #include <ios>
 #include <iosfwd>
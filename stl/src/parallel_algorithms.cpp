@@ -3,10 +3,19 @@
 
 // support for <execution>
 
+#include <atomic>
 #include <internal_shared.h>
 #include <thread>
 #include <xatomic_wait.h>
 
+namespace {
+    // Parallel regions are the lifetimes of <execution>'s _Work_ptr on the submitting thread, and of its callbacks on
+    // the threads that run them. An algorithm started inside a region sizes itself by the threads not already busy
+    // with the enclosing one, instead of queueing another hardware_concurrency() worth of chunks.
+    thread_local unsigned int _Parallel_region_depth = 0;
+    _STD atomic<unsigned int> _Threads_in_parallel_regions{0};
+} // unnamed namespace
+
 extern "C" {
 
 [[nodiscard]] unsigned int __stdcall __std_parallel_algorithms_hw_threads() noexcept {
@@ -17,7 +26,27 @@ extern "C" {
         __iso_volatile_store32(&_Cached_hw_concurrency, _Hw_concurrency);
     }
 
-    return static_cast<unsigned int>(_Hw_concurrency);
+    const auto _Hw_threads = static_cast<unsigned int>(_Hw_concurrency);
+    if (_Parallel_region_depth == 0) {
+        return _Hw_threads;
+    }
+
+    // nested: share the machine evenly among the threads already running parallel regions; once every hardware
+    // thread is busy this returns 1, which runs the nested algorithm serially
+    const unsigned int _Busy = _Threads_in_parallel_regions.load(_STD memory_order_relaxed);
+    return _Busy >= _Hw_threads ? 1 : _Hw_threads / _Busy;
+}
+
+void __stdcall __std_parallel_algorithms_enter_region() noexcept {
+    if (_Parallel_region_depth++ == 0) {
+        _Threads_in_parallel_regions.fetch_add(1, _STD memory_order_relaxed);
+    }
+}
+
+void __stdcall __std_parallel_algorithms_leave_region() noexcept {
+    if (--_Parallel_region_depth == 0) {
+        _Threads_in_parallel_regions.fetch_sub(1, _STD memory_order_relaxed);
+    }
 }
 
 [[nodiscard]] PTP_WORK __stdcall __std_create_threadpool_work(
@@ -0,0 +1,438 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// work-stealing scheduler for <execution>, selected by _USE_PARALLEL_ALGORITHMS_WORK_STEALING
+
+// This file uses only standard threads, atomics, and locks, so that the scheduler doesn't depend on the Windows thread
+// pool. The __std_*_scheduler_work functions have the same contract as the __std_*_threadpool_work functions in
+// parallel_algorithms.cpp: the callback receives a null instance and the work handle, and a cancelling wait drops the
+// callbacks that haven't started.
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+struct __std_TP_WORK; // not defined
+struct __std_TP_CALLBACK_INSTANCE; // not defined
+
+namespace {
+    using _Work_callback = void(__stdcall*)(__std_TP_CALLBACK_INSTANCE*, void*, __std_TP_WORK*);
+
+    struct _Work_item {
+        _Work_callback _Callback;
+        void* _Context;
+        _STD atomic<size_t> _Pending{0}; // submitted callbacks no thread has claimed yet
+        _STD atomic<size_t> _Outstanding{0}; // pending plus running callbacks; waiters block until this is 0
+        _STD atomic<size_t> _Refs{1}; // one for the handle, plus one for every queue entry naming this item
+
+        _Work_item(const _Work_callback _Callback_, void* const _Context_) noexcept
+            : _Callback(_Callback_), _Context(_Context_) {}
+
+        void _Add_ref() noexcept {
+            _Refs.fetch_add(1, _STD memory_order_relaxed);
+        }
+
+        void _Release() noexcept {
+            if (_Refs.fetch_sub(1, _STD memory_order_acq_rel) == 1) {
+                delete this;
+            }
+        }
+
+        [[nodiscard]] bool _Try_claim() noexcept {
+            size_t _Expected = _Pending.load(_STD memory_order_relaxed);
+            while (_Expected != 0) {
+                if (_Pending.compare_exchange_weak(_Expected, _Expected - 1)) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        void _Invoke_claimed() noexcept {
+            // the caller holds a reference, so notifying after the count reaches 0 can't touch a deleted item
+            _Callback(nullptr, _Context, reinterpret_cast<__std_TP_WORK*>(this));
+            if (_Outstanding.fetch_sub(1) == 1) {
+                _Outstanding.notify_all();
+            }
+        }
+    };
+
+    // Chase-Lev deque (Le, Pop, Cohen, and Zappa Nardelli,
+    // "Correct and Efficient Work-Stealing for Weak Memory Models", PPoPP 2013).
+    // Only the owning worker calls _Push and _Pop; any thread may call _Steal.
+    class _Chase_lev_deque {
+    public:
+        _Chase_lev_deque() {
+            auto _Initial = _STD make_unique<_Ring>(_Initial_capacity); // throws
+            _Array.store(_Initial.get(), _STD memory_order_relaxed);
+            _Retired.push_back(_STD move(_Initial)); // throws
+        }
+
+        _Chase_lev_deque(const _Chase_lev_deque&)            = delete;
+        _Chase_lev_deque& operator=(const _Chase_lev_deque&) = delete;
+
+        void _Push(_Work_item* const _Item) {
+            const ptrdiff_t _Bottom_local = _Bottom.load(_STD memory_order_relaxed);
+            const ptrdiff_t _Top_local    = _Top.load(_STD memory_order_acquire);
+            _Ring* _Ring_local            = _Array.load(_STD memory_order_relaxed);
+            if (_Bottom_local - _Top_local > static_cast<ptrdiff_t>(_Ring_local->_Mask)) {
+                _Ring_local = _Grow(_Ring_local, _Top_local, _Bottom_local); // throws
+            }
+
+            _Ring_local->_Put(_Bottom_local, _Item);
+            _Bottom.store(_Bottom_local + 1, _STD memory_order_release); // the paper's release fence, as a store
+        }
+
+        [[nodiscard]] _Work_item* _Pop() noexcept {
+            const ptrdiff_t _Bottom_local = _Bottom.load(_STD memory_order_relaxed) - 1;
+            _Ring* const _Ring_local      = _Array.load(_STD memory_order_relaxed);
+            _Bottom.store(_Bottom_local, _STD memory_order_relaxed);
+            _STD atomic_thread_fence(_STD memory_order_seq_cst);
+            ptrdiff_t _Top_local = _Top.load(_STD memory_order_relaxed);
+            if (_Top_local > _Bottom_local) { // empty
+                _Bottom.store(_Bottom_local + 1, _STD memory_order_relaxed);
+                return nullptr;
+            }
+
+            _Work_item* _Item = _Ring_local->_Get(_Bottom_local);
+            if (_Top_local == _Bottom_local) { // last element; race thieves for it
+                if (!_Top.compare_exchange_strong(
+                        _Top_local, _Top_local + 1, _STD memory_order_seq_cst, _STD memory_order_relaxed)) {
+                    _Item = nullptr;
+                }
+
+                _Bottom.store(_Bottom_local + 1, _STD memory_order_relaxed);
+            }
+
+            return _Item;
+        }
+
+        [[nodiscard]] _Work_item* _Steal() noexcept {
+            ptrdiff_t _Top_local = _Top.load(_STD memory_order_acquire);
+            _STD atomic_thread_fence(_STD memory_order_seq_cst);
+            const ptrdiff_t _Bottom_local = _Bottom.load(_STD memory_order_acquire);
+            if (_Top_local >= _Bottom_local) {
+                return nullptr;
+            }
+
+            _Work_item* const _Item = _Array.load(_STD memory_order_acquire)->_Get(_Top_local);
+            if (!_Top.compare_exchange_strong(
+                    _Top_local, _Top_local + 1, _STD memory_order_seq_cst, _STD memory_order_relaxed)) {
+                return nullptr; // lost the race to the owner or another thief
+            }
+
+            return _Item;
+        }
+
+    private:
+        static constexpr size_t _Initial_capacity = 64;
+
+        struct _Ring {
+            size_t _Mask;
+            _STD unique_ptr<_STD atomic<_Work_item*>[]> _Slots;
+
+            explicit _Ring(const size_t _Capacity)
+                : _Mask(_Capacity - 1), _Slots(new _STD atomic<_Work_item*>[_Capacity]) {}
+
+            [[nodiscard]] _Work_item* _Get(const ptrdiff_t _Idx) const noexcept {
+                return _Slots[static_cast<size_t>(_Idx) & _Mask].load(_STD memory_order_relaxed);
+            }
+
+            void _Put(const ptrdiff_t _Idx, _Work_item* const _Item) noexcept {
+                _Slots[static_cast<size_t>(_Idx) & _Mask].store(_Item, _STD memory_order_relaxed);
+            }
+        };
+
+        _Ring* _Grow(_Ring* const _Old, const ptrdiff_t _Top_local, const ptrdiff_t _Bottom_local) {
+            // thieves may still be reading _Old, so it stays alive (in _Retired) as long as the deque
+            _Retired.reserve(_Retired.size() + 1); // throws
+            auto _New = _STD make_unique<_Ring>((_Old->_Mask + 1) * 2); // throws
+            for (ptrdiff_t _Idx = _Top_local; _Idx < _Bottom_local; ++_Idx) {
+                _New->_Put(_Idx, _Old->_Get(_Idx));
+            }
+
+            _Ring* const _Result = _New.get();
+            _Retired.push_back(_STD move(_New));
+            _Array.store(_Result, _STD memory_order_release);
+            return _Result;
+        }
+
+        alignas(_STD hardware_destructive_interference_size) _STD atomic<ptrdiff_t> _Top{0};
+        alignas(_STD hardware_destructive_interference_size) _STD atomic<ptrdiff_t> _Bottom{0};
+        _STD atomic<_Ring*> _Array;
+        _STD vector<_STD unique_ptr<_Ring>> _Retired; // owner only
+    };
+
+    class _Scheduler;
+
+#pragma warning(push)
+#pragma warning(disable : 4324) // structure was padded due to alignment specifier
+    struct alignas(_STD hardware_destructive_interference_size) _Worker {
+        _Chase_lev_deque _Deque;
+        _Scheduler* _Owner = nullptr;
+        size_t _Index      = 0;
+    };
+#pragma warning(pop)
+
+    thread_local _Worker* _Current_worker = nullptr;
+
+    // this file is built without thread-safe function-local statics, so the scheduler is created under a lock
+    constinit _STD atomic<_Scheduler*> _Scheduler_instance{nullptr};
+    constinit _STD mutex _Scheduler_creation_mutex;
+
+    class _Scheduler {
+    public:
+        // The scheduler and its workers live until the process exits. Workers are detached rather than joined, because
+        // they may be blocked in an atomic wait when static destructors run.
+        [[nodiscard]] static _Scheduler* _Instance() noexcept {
+            _Scheduler* _Result = _Scheduler_instance.load(_STD memory_order_acquire);
+            if (!_Result) {
+                _STD lock_guard<_STD mutex> _Lock{_Scheduler_creation_mutex};
+                _Result = _Scheduler_instance.load(_STD memory_order_relaxed);
+                if (!_Result) { // a failed creation is retried by the next caller
+                    _Result = _Try_create();
+                    _Scheduler_instance.store(_Result, _STD memory_order_release);
+                }
+            }
+
+            return _Result;
+        }
+
+        void _Submit(_Work_item* const _Item, const size_t _Submissions) noexcept {
+            if (_Submissions == 0) {
+                return;
+            }
+
+            // _Outstanding goes first, so a worker that claims a callback never sees it underflow
+            _Item->_Outstanding.fetch_add(_Submissions);
+            _Item->_Pending.fetch_add(_Submissions);
+            // All _Submissions callbacks are published with a single queue entry. Whichever worker takes it claims one
+            // callback and republishes the entry on its own deque while more remain.
+            _Publish(_Item);
+            _Wake(_Submissions);
+        }
+
+    private:
+        static constexpr int _Spin_rounds = 64;
+
+        explicit _Scheduler(const size_t _Worker_count) : _Workers(_Worker_count) {}
+
+        [[nodiscard]] static _Scheduler* _Try_create() noexcept {
+            // the calling thread always takes part in a parallel algorithm, so one fewer worker than hardware threads
+            // keeps the machine exactly subscribed
+            const unsigned int _Hw_threads = _STD thread::hardware_concurrency();
+            const size_t _Worker_count     = _Hw_threads > 1 ? _Hw_threads - 1 : 1;
+            _Scheduler* _Result;
+            try {
+                _Result = new _Scheduler(_Worker_count);
+            } catch (...) {
+                return nullptr;
+            }
+
+            for (size_t _Idx = 0; _Idx < _Worker_count; ++_Idx) {
+                _Worker& _Self = _Result->_Workers[_Idx];
+                _Self._Owner   = _Result;
+                _Self._Index   = _Idx;
+            }
+
+            try {
+                for (size_t _Idx = 0; _Idx < _Worker_count; ++_Idx) {
+                    _STD thread{&_Scheduler::_Worker_loop, &_Result->_Workers[_Idx]}.detach();
+                    _Result->_Started.fetch_add(1, _STD memory_order_relaxed);
+                }
+            } catch (...) {
+                if (_Result->_Started.load(_STD memory_order_relaxed) == 0) {
+                    delete _Result;
+                    return nullptr;
+                }
+
+                // Run with the workers that did start. Entries on the missing workers' deques are never pushed, since
+                // only a worker pushes to its own deque.
+            }
+
+            return _Result;
+        }
+
+        static void _Worker_loop(_Worker* const _Self) noexcept {
+            _Current_worker  = _Self;
+            _Scheduler& _Sch = *_Self->_Owner;
+            for (;;) {
+                if (_Sch._Run_one(*_Self)) {
+                    continue;
+                }
+
+                bool _Found = false;
+                for (int _Round = 0; _Round < _Spin_rounds && !_Found; ++_Round) {
+                    _STD this_thread::yield();
+                    _Found = _Sch._Run_one(*_Self);
+                }
+
+                if (_Found) {
+                    continue;
+                }
+
+                // Sleep until _Epoch changes. _Wake bumps _Epoch after publishing, then reads _Sleepers; this thread
+                // bumps _Sleepers, then looks for work. The fences make sure that either _Wake sees this thread and
+                // notifies it, or the recheck below finds the entry.
+                const unsigned int _Epoch_local = _Sch._Epoch.load();
+                _Sch._Sleepers.fetch_add(1);
+                _STD atomic_thread_fence(_STD memory_order_seq_cst);
+                if (!_Sch._Run_one(*_Self)) {
+                    _Sch._Epoch.wait(_Epoch_local);
+                }
+
+                _Sch._Sleepers.fetch_sub(1);
+            }
+        }
+
+        void _Publish(_Work_item* const _Item) noexcept {
+            _Item->_Add_ref();
+            if (_Worker* const _Self = _Current_worker; _Self && _Self->_Owner == this) {
+                try {
+                    _Self->_Deque._Push(_Item);
+                    return;
+                } catch (...) {
+                    // fall back to the injection queue
+                }
+            }
+
+            try {
+                _STD lock_guard<_STD mutex> _Lock{_Injection_mutex};
+                _Injection.push_back(_Item);
+                _Injection_size.store(_Injection.size(), _STD memory_order_relaxed);
+            } catch (...) {
+                // Nowhere to queue the entry. The submitter runs all of a parallel algorithm's chunks itself if no
+                // callback ever starts, and waiters cancel or run the pending callbacks, so dropping the entry loses
+                // only parallelism.
+                _Item->_Release();
+            }
+        }
+
+        void _Wake(const size_t _Submissions) noexcept {
+            _Epoch.fetch_add(1);
+            _STD atomic_thread_fence(_STD memory_order_seq_cst);
+            if (_Sleepers.load() != 0) {
+                if (_Submissions == 1) {
+                    _Epoch.notify_one();
+                } else {
+                    _Epoch.notify_all();
+                }
+            }
+        }
+
+        [[nodiscard]] _Work_item* _Take_injected() noexcept {
+            if (_Injection_size.load(_STD memory_order_relaxed) == 0) {
+                return nullptr;
+            }
+
+            _STD lock_guard<_STD mutex> _Lock{_Injection_mutex};
+            if (_Injection.empty()) {
+                return nullptr;
+            }
+
+            _Work_item* const _Item = _Injection.front();
+            _Injection.pop_front();
+            _Injection_size.store(_Injection.size(), _STD memory_order_relaxed);
+            return _Item;
+        }
+
+        [[nodiscard]] _Work_item* _Find_work(_Worker& _Self) noexcept {
+            if (const auto _Item = _Self._Deque._Pop()) {
+                return _Item;
+            }
+
+            if (const auto _Item = _Take_injected()) {
+                return _Item;
+            }
+
+            const size_t _Worker_count = _Started.load(_STD memory_order_relaxed);
+            for (size_t _Offset = 1; _Offset < _Worker_count; ++_Offset) {
+                if (const auto _Item = _Workers[(_Self._Index + _Offset) % _Worker_count]._Deque._Steal()) {
+                    return _Item;
+                }
+            }
+
+            return nullptr;
+        }
+
+        bool _Run_one(_Worker& _Self) noexcept {
+            _Work_item* const _Item = _Find_work(_Self);
+            if (!_Item) {
+                return false;
+            }
+
+            if (_Item->_Try_claim()) {
+                if (_Item->_Pending.load(_STD memory_order_relaxed) != 0) {
+                    _Publish(_Item);
+                    _Wake(1);
+                }
+
+                _Item->_Invoke_claimed();
+            }
+
+            _Item->_Release();
+            return true;
+        }
+
+        _STD vector<_Worker> _Workers;
+        _STD atomic<size_t> _Started{0}; // workers whose threads are running; only they are stolen from
+        _STD mutex _Injection_mutex;
+        _STD deque<_Work_item*> _Injection; // entries from threads that aren't workers
+        _STD atomic<size_t> _Injection_size{0};
+        _STD atomic<unsigned int> _Epoch{0};
+        _STD atomic<unsigned int> _Sleepers{0};
+    };
+} // unnamed namespace
+
+extern "C" {
+
+[[nodiscard]] __std_TP_WORK* __stdcall __std_create_scheduler_work(
+    const _Work_callback _Callback, void* const _Context) noexcept {
+    if (!_Scheduler::_Instance()) {
+        return nullptr;
+    }
+
+    return reinterpret_cast<__std_TP_WORK*>(new (_STD nothrow) _Work_item(_Callback, _Context));
+}
+
+void __stdcall __std_submit_scheduler_work(__std_TP_WORK* const _Work, const size_t _Submissions) noexcept {
+    // only called with a handle from __std_create_scheduler_work, so the scheduler exists
+    _Scheduler::_Instance()->_Submit(reinterpret_cast<_Work_item*>(_Work), _Submissions);
+}
+
+void __stdcall __std_close_scheduler_work(__std_TP_WORK* const _Work) noexcept {
+    // queue entries that still name the item keep it alive until the workers discard them
+    reinterpret_cast<_Work_item*>(_Work)->_Release();
+}
+
+void __stdcall __std_wait_for_scheduler_work_callbacks(__std_TP_WORK* const _Work, const int _Cancel) noexcept {
+    const auto _Item = reinterpret_cast<_Work_item*>(_Work);
+    if (_Cancel) {
+        const size_t _Canceled = _Item->_Pending.exchange(0);
+        if (_Canceled != 0 && _Item->_Outstanding.fetch_sub(_Canceled) == _Canceled) {
+            return;
+        }
+    } else {
+        // run the callbacks no worker has started yet here, so that waiting from a worker can't deadlock
+        while (_Item->_Try_claim()) {
+            _Item->_Invoke_claimed();
+        }
+    }
+
+    for (;;) {
+        const size_t _Outstanding = _Item->_Outstanding.load();
+        if (_Outstanding == 0) {
+            return;
+        }
+
+        _Item->_Outstanding.wait(_Outstanding);
+    }
+}
+
+} // extern "C"
@@ -23,6 +23,10 @@ extern "C" long __isa_enabled;
 #endif // !defined(_DEBUG)
 
 namespace {
+    bool _Use_avx512() noexcept { // AVX-512 F, CD, BW, DQ, and VL, with the OS saving the ZMM state
+        return __isa_enabled & (1 << __ISA_AVAILABLE_AVX512);
+    }
+
     bool _Use_avx2() noexcept {
         return __isa_enabled & (1 << __ISA_AVAILABLE_AVX2);
     }
@@ -31,6 +35,14 @@ namespace {
         return __isa_enabled & (1 << __ISA_AVAILABLE_SSE42);
     }
 
+    bool _Use_sse2() noexcept { // for kernels that need nothing newer; every x64 processor has SSE2
+#ifdef _M_IX86
+        return __isa_enabled & (1 << __ISA_AVAILABLE_SSE2);
+#else // ^^^ defined(_M_IX86) / defined(_M_X64) vvv
+        return true;
+#endif // ^^^ defined(_M_X64) ^^^
+    }
+
     struct [[nodiscard]] _Zeroupper_on_exit { // TRANSITION, DevCom-10331414
         _Zeroupper_on_exit() = default;
 
@@ -48,6 +60,45 @@ namespace {
             ~0u, ~0u, ~0u, ~0u, ~0u, ~0u, ~0u, ~0u, 0, 0, 0, 0, 0, 0, 0, 0};
         return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Tail_masks + (8 - _Count_in_dwords)));
     }
+
+    uint64_t _Avx512_tail_mask(const size_t _Count) noexcept {
+        // _Count must be within [0, 63]. Sets the lowest _Count bits, for masking bytes or elements of a ZMM register.
+        return (uint64_t{1} << _Count) - 1;
+    }
+
+    unsigned long _Avx512_first_bit(const uint64_t _Mask) noexcept {
+        // _Mask must be nonzero. Returns the index of the lowest set bit, which is the first matching element.
+#ifdef _M_IX86
+        if (const auto _Low = static_cast<uint32_t>(_Mask); _Low != 0) {
+            return _tzcnt_u32(_Low);
+        }
+
+        return 32 + _tzcnt_u32(static_cast<uint32_t>(_Mask >> 32));
+#else // ^^^ defined(_M_IX86) / defined(_M_X64) vvv
+        return static_cast<unsigned long>(_tzcnt_u64(_Mask));
+#endif // ^^^ defined(_M_X64) ^^^
+    }
+
+    unsigned long _Avx512_last_bit(const uint64_t _Mask) noexcept {
+        // _Mask must be nonzero. Returns the index of the highest set bit, which is the last matching element.
+#ifdef _M_IX86
+        if (const auto _High = static_cast<uint32_t>(_Mask >> 32); _High != 0) {
+            return 63 - _lzcnt_u32(_High);
+        }
+
+        return 31 - _lzcnt_u32(static_cast<uint32_t>(_Mask));
+#else // ^^^ defined(_M_IX86) / defined(_M_X64) vvv
+        return 63 - static_cast<unsigned long>(_lzcnt_u64(_Mask));
+#endif // ^^^ defined(_M_X64) ^^^
+    }
+
+    size_t _Avx512_popcount(const uint64_t _Mask) noexcept {
+#ifdef _M_IX86
+        return __popcnt(static_cast<uint32_t>(_Mask)) + __popcnt(static_cast<uint32_t>(_Mask >> 32));
+#else // ^^^ defined(_M_IX86) / defined(_M_X64) vvv
+        return __popcnt64(_Mask);
+#endif // ^^^ defined(_M_X64) ^^^
+    }
 } // namespace
 #endif // !defined(_M_ARM64EC)
 
@@ -1732,51 +1783,301 @@ namespace {
     };
 #endif // !defined(_M_ARM64EC)
 
+#ifndef _M_ARM64EC
+    // The AVX-512 traits are used only to find values, not positions. Comparisons produce bit masks there, and the
+    // element-finding algorithms above are built around byte masks from movemask, so they stay on AVX2.
+    struct _Minmax_traits_1_avx512 : _Minmax_traits_1_base {
+        static __m512i _Load(const void* _Src) noexcept {
+            return _mm512_loadu_si512(_Src);
+        }
+
+        static __m512i _Load_merge(const __m512i _Fill, const size_t _Count, const void* _Src) noexcept {
+            return _mm512_mask_loadu_epi8(_Fill, _Avx512_tail_mask(_Count), _Src);
+        }
+
+        static __m512i _Min(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_min_epi8(_First, _Second);
+        }
+
+        static __m512i _Max(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_max_epi8(_First, _Second);
+        }
+
+        static __m512i _Min_u(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_min_epu8(_First, _Second);
+        }
+
+        static __m512i _Max_u(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_max_epu8(_First, _Second);
+        }
+
+        static _Signed_t _H_min(const __m512i _Cur) noexcept {
+            const __m256i _Half = _mm256_min_epi8(_mm512_castsi512_si256(_Cur), _mm512_extracti64x4_epi64(_Cur, 1));
+            return _Minmax_traits_1_avx::_Get_any(_Minmax_traits_1_avx::_H_min(_Half));
+        }
+
+        static _Signed_t _H_max(const __m512i _Cur) noexcept {
+            const __m256i _Half = _mm256_max_epi8(_mm512_castsi512_si256(_Cur), _mm512_extracti64x4_epi64(_Cur, 1));
+            return _Minmax_traits_1_avx::_Get_any(_Minmax_traits_1_avx::_H_max(_Half));
+        }
+
+        static _Signed_t _H_min_u(const __m512i _Cur) noexcept {
+            const __m256i _Half = _mm256_min_epu8(_mm512_castsi512_si256(_Cur), _mm512_extracti64x4_epi64(_Cur, 1));
+            return _Minmax_traits_1_avx::_Get_any(_Minmax_traits_1_avx::_H_min_u(_Half));
+        }
+
+        static _Signed_t _H_max_u(const __m512i _Cur) noexcept {
+            const __m256i _Half = _mm256_max_epu8(_mm512_castsi512_si256(_Cur), _mm512_extracti64x4_epi64(_Cur, 1));
+            return _Minmax_traits_1_avx::_Get_any(_Minmax_traits_1_avx::_H_max_u(_Half));
+        }
+    };
+
+    struct _Minmax_traits_2_avx512 : _Minmax_traits_2_base {
+        static __m512i _Load(const void* _Src) noexcept {
+            return _mm512_loadu_si512(_Src);
+        }
+
+        static __m512i _Load_merge(const __m512i _Fill, const size_t _Count, const void* _Src) noexcept {
+            return _mm512_mask_loadu_epi16(_Fill, static_cast<__mmask32>(_Avx512_tail_mask(_Count)), _Src);
+        }
+
+        static __m512i _Min(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_min_epi16(_First, _Second);
+        }
+
+        static __m512i _Max(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_max_epi16(_First, _Second);
+        }
+
+        static __m512i _Min_u(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_min_epu16(_First, _Second);
+        }
+
+        static __m512i _Max_u(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_max_epu16(_First, _Second);
+        }
+
+        static _Signed_t _H_min(const __m512i _Cur) noexcept {
+            const __m256i _Half = _mm256_min_epi16(_mm512_castsi512_si256(_Cur), _mm512_extracti64x4_epi64(_Cur, 1));
+            return _Minmax_traits_2_avx::_Get_any(_Minmax_traits_2_avx::_H_min(_Half));
+        }
+
+        static _Signed_t _H_max(const __m512i _Cur) noexcept {
+            const __m256i _Half = _mm256_max_epi16(_mm512_castsi512_si256(_Cur), _mm512_extracti64x4_epi64(_Cur, 1));
+            return _Minmax_traits_2_avx::_Get_any(_Minmax_traits_2_avx::_H_max(_Half));
+        }
+
+        static _Signed_t _H_min_u(const __m512i _Cur) noexcept {
+            const __m256i _Half = _mm256_min_epu16(_mm512_castsi512_si256(_Cur), _mm512_extracti64x4_epi64(_Cur, 1));
+            return _Minmax_traits_2_avx::_Get_any(_Minmax_traits_2_avx::_H_min_u(_Half));
+        }
+
+        static _Signed_t _H_max_u(const __m512i _Cur) noexcept {
+            const __m256i _Half = _mm256_max_epu16(_mm512_castsi512_si256(_Cur), _mm512_extracti64x4_epi64(_Cur, 1));
+            return _Minmax_traits_2_avx::_Get_any(_Minmax_traits_2_avx::_H_max_u(_Half));
+        }
+    };
+
+    struct _Minmax_traits_4_avx512 : _Minmax_traits_4_base {
+        static __m512i _Load(const void* _Src) noexcept {
+            return _mm512_loadu_si512(_Src);
+        }
+
+        static __m512i _Load_merge(const __m512i _Fill, const size_t _Count, const void* _Src) noexcept {
+            return _mm512_mask_loadu_epi32(_Fill, static_cast<__mmask16>(_Avx512_tail_mask(_Count)), _Src);
+        }
+
+        static __m512i _Min(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_min_epi32(_First, _Second);
+        }
+
+        static __m512i _Max(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_max_epi32(_First, _Second);
+        }
+
+        static __m512i _Min_u(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_min_epu32(_First, _Second);
+        }
+
+        static __m512i _Max_u(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_max_epu32(_First, _Second);
+        }
+
+        static _Signed_t _H_min(const __m512i _Cur) noexcept {
+            const __m256i _Half = _mm256_min_epi32(_mm512_castsi512_si256(_Cur), _mm512_extracti64x4_epi64(_Cur, 1));
+            return _Minmax_traits_4_avx::_Get_any(_Minmax_traits_4_avx::_H_min(_Half));
+        }
+
+        static _Signed_t _H_max(const __m512i _Cur) noexcept {
+            const __m256i _Half = _mm256_max_epi32(_mm512_castsi512_si256(_Cur), _mm512_extracti64x4_epi64(_Cur, 1));
+            return _Minmax_traits_4_avx::_Get_any(_Minmax_traits_4_avx::_H_max(_Half));
+        }
+
+        static _Signed_t _H_min_u(const __m512i _Cur) noexcept {
+            const __m256i _Half = _mm256_min_epu32(_mm512_castsi512_si256(_Cur), _mm512_extracti64x4_epi64(_Cur, 1));
+            return _Minmax_traits_4_avx::_Get_any(_Minmax_traits_4_avx::_H_min_u(_Half));
+        }
+
+        static _Signed_t _H_max_u(const __m512i _Cur) noexcept {
+            const __m256i _Half = _mm256_max_epu32(_mm512_castsi512_si256(_Cur), _mm512_extracti64x4_epi64(_Cur, 1));
+            return _Minmax_traits_4_avx::_Get_any(_Minmax_traits_4_avx::_H_max_u(_Half));
+        }
+    };
+
+    struct _Minmax_traits_8_avx512 : _Minmax_traits_8_base {
+        static __m512i _Load(const void* _Src) noexcept {
+            return _mm512_loadu_si512(_Src);
+        }
+
+        static __m512i _Load_merge(const __m512i _Fill, const size_t _Count, const void* _Src) noexcept {
+            return _mm512_mask_loadu_epi64(_Fill, static_cast<__mmask8>(_Avx512_tail_mask(_Count)), _Src);
+        }
+
+        static __m512i _Min(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_min_epi64(_First, _Second);
+        }
+
+        static __m512i _Max(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_max_epi64(_First, _Second);
+        }
+
+        static __m512i _Min_u(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_min_epu64(_First, _Second);
+        }
+
+        static __m512i _Max_u(const __m512i _First, const __m512i _Second) noexcept {
+            return _mm512_max_epu64(_First, _Second);
+        }
+
+        static _Signed_t _H_min(const __m512i _Cur) noexcept {
+            const __m256i _Half = _mm256_min_epi64(_mm512_castsi512_si256(_Cur), _mm512_extracti64x4_epi64(_Cur, 1));
+            return _Minmax_traits_8_avx::_Get_any(_Minmax_traits_8_avx::_H_min(_Half));
+        }
+
+        static _Signed_t _H_max(const __m512i _Cur) noexcept {
+            const __m256i _Half = _mm256_max_epi64(_mm512_castsi512_si256(_Cur), _mm512_extracti64x4_epi64(_Cur, 1));
+            return _Minmax_traits_8_avx::_Get_any(_Minmax_traits_8_avx::_H_max(_Half));
+        }
+
+        static _Signed_t _H_min_u(const __m512i _Cur) noexcept {
+            const __m256i _Half = _mm256_min_epu64(_mm512_castsi512_si256(_Cur), _mm512_extracti64x4_epi64(_Cur, 1));
+            return _Minmax_traits_8_avx::_Get_any(_Minmax_traits_8_avx::_H_min_u(_Half));
+        }
+
+        static _Signed_t _H_max_u(const __m512i _Cur) noexcept {
+            const __m256i _Half = _mm256_max_epu64(_mm512_castsi512_si256(_Cur), _mm512_extracti64x4_epi64(_Cur, 1));
+            return _Minmax_traits_8_avx::_Get_any(_Minmax_traits_8_avx::_H_max_u(_Half));
+        }
+    };
+
+    struct _Minmax_traits_f_avx512 : _Minmax_traits_f_base {
+        static __m512 _Load(const void* _Src) noexcept {
+            return _mm512_loadu_ps(_Src);
+        }
+
+        static __m512 _Load_merge(const __m512 _Fill, const size_t _Count, const void* _Src) noexcept {
+            return _mm512_mask_loadu_ps(_Fill, static_cast<__mmask16>(_Avx512_tail_mask(_Count)), _Src);
+        }
+
+        static __m512 _Min(const __m512 _First, const __m512 _Second) noexcept {
+            return _mm512_min_ps(_Second, _First);
+        }
+
+        static __m512 _Max(const __m512 _First, const __m512 _Second) noexcept {
+            return _mm512_max_ps(_Second, _First);
+        }
+
+        static float _H_min(const __m512 _Cur) noexcept {
+            const __m256 _Half = _mm256_min_ps(_mm512_extractf32x8_ps(_Cur, 1), _mm512_castps512_ps256(_Cur));
+            return _Minmax_traits_f_avx::_Get_any(_Minmax_traits_f_avx::_H_min(_Half));
+        }
+
+        static float _H_max(const __m512 _Cur) noexcept {
+            const __m256 _Half = _mm256_max_ps(_mm512_extractf32x8_ps(_Cur, 1), _mm512_castps512_ps256(_Cur));
+            return _Minmax_traits_f_avx::_Get_any(_Minmax_traits_f_avx::_H_max(_Half));
+        }
+    };
+
+    struct _Minmax_traits_d_avx512 : _Minmax_traits_d_base {
+        static __m512d _Load(const void* _Src) noexcept {
+            return _mm512_loadu_pd(_Src);
+        }
+
+        static __m512d _Load_merge(const __m512d _Fill, const size_t _Count, const void* _Src) noexcept {
+            return _mm512_mask_loadu_pd(_Fill, static_cast<__mmask8>(_Avx512_tail_mask(_Count)), _Src);
+        }
+
+        static __m512d _Min(const __m512d _First, const __m512d _Second) noexcept {
+            return _mm512_min_pd(_Second, _First);
+        }
+
+        static __m512d _Max(const __m512d _First, const __m512d _Second) noexcept {
+            return _mm512_max_pd(_Second, _First);
+        }
+
+        static double _H_min(const __m512d _Cur) noexcept {
+            const __m256d _Half = _mm256_min_pd(_mm512_extractf64x4_pd(_Cur, 1), _mm512_castpd512_pd256(_Cur));
+            return _Minmax_traits_d_avx::_Get_any(_Minmax_traits_d_avx::_H_min(_Half));
+        }
+
+        static double _H_max(const __m512d _Cur) noexcept {
+            const __m256d _Half = _mm256_max_pd(_mm512_extractf64x4_pd(_Cur, 1), _mm512_castpd512_pd256(_Cur));
+            return _Minmax_traits_d_avx::_Get_any(_Minmax_traits_d_avx::_H_max(_Half));
+        }
+    };
+#endif // !defined(_M_ARM64EC)
+
     struct _Minmax_traits_1 {
         using _Scalar = _Minmax_traits_scalar<_Minmax_traits_1_base>;
 #ifndef _M_ARM64EC
-        using _Sse = _Minmax_traits_1_sse;
-        using _Avx = _Minmax_traits_1_avx;
+        using _Sse    = _Minmax_traits_1_sse;
+        using _Avx    = _Minmax_traits_1_avx;
+        using _Avx512 = _Minmax_traits_1_avx512;
 #endif // !defined(_M_ARM64EC)
     };
 
     struct _Minmax_traits_2 {
         using _Scalar = _Minmax_traits_scalar<_Minmax_traits_2_base>;
 #ifndef _M_ARM64EC
-        using _Sse = _Minmax_traits_2_sse;
-        using _Avx = _Minmax_traits_2_avx;
+        using _Sse    = _Minmax_traits_2_sse;
+        using _Avx    = _Minmax_traits_2_avx;
+        using _Avx512 = _Minmax_traits_2_avx512;
 #endif // !defined(_M_ARM64EC)
     };
 
     struct _Minmax_traits_4 {
         using _Scalar = _Minmax_traits_scalar<_Minmax_traits_4_base>;
 #ifndef _M_ARM64EC
-        using _Sse = _Minmax_traits_4_sse;
-        using _Avx = _Minmax_traits_4_avx;
+        using _Sse    = _Minmax_traits_4_sse;
+        using _Avx    = _Minmax_traits_4_avx;
+        using _Avx512 = _Minmax_traits_4_avx512;
 #endif // !defined(_M_ARM64EC)
     };
 
     struct _Minmax_traits_8 {
         using _Scalar = _Minmax_traits_scalar<_Minmax_traits_8_base>;
 #ifndef _M_ARM64EC
-        using _Sse = _Minmax_traits_8_sse;
-        using _Avx = _Minmax_traits_8_avx;
+        using _Sse    = _Minmax_traits_8_sse;
+        using _Avx    = _Minmax_traits_8_avx;
+        using _Avx512 = _Minmax_traits_8_avx512;
 #endif // !defined(_M_ARM64EC)
     };
 
     struct _Minmax_traits_f {
         using _Scalar = _Minmax_traits_scalar<_Minmax_traits_f_base>;
 #ifndef _M_ARM64EC
-        using _Sse = _Minmax_traits_f_sse;
-        using _Avx = _Minmax_traits_f_avx;
+        using _Sse    = _Minmax_traits_f_sse;
+        using _Avx    = _Minmax_traits_f_avx;
+        using _Avx512 = _Minmax_traits_f_avx512;
 #endif // !defined(_M_ARM64EC)
     };
 
     struct _Minmax_traits_d {
         using _Scalar = _Minmax_traits_scalar<_Minmax_traits_d_base>;
 #ifndef _M_ARM64EC
-        using _Sse = _Minmax_traits_d_sse;
-        using _Avx = _Minmax_traits_d_avx;
+        using _Sse    = _Minmax_traits_d_sse;
+        using _Avx    = _Minmax_traits_d_avx;
+        using _Avx512 = _Minmax_traits_d_avx512;
 #endif // !defined(_M_ARM64EC)
     };
 
@@ -2223,6 +2524,78 @@ namespace {
     }
 
 #ifndef _M_ARM64EC
+    template <_Min_max_mode _Mode, class _Traits, bool _Sign>
+    auto __std_minmax_impl_avx512(const void* _First, const void* const _Last) noexcept {
+        // Requires at least one full vector. The tail is loaded with masking over the first vector, whose values were
+        // already accounted for, so there is no scalar epilogue. AVX-512 also has unsigned 64-bit min and max,
+        // so no sign correction is needed.
+        using _Ty = std::conditional_t<_Sign, typename _Traits::_Signed_t, typename _Traits::_Unsigned_t>;
+
+        const size_t _Total_size_bytes = _Byte_length(_First, _Last);
+        const void* _Stop_at           = _First;
+        _Advance_bytes(_Stop_at, _Total_size_bytes & ~size_t{0x3F});
+
+        const auto _First_vals = _Traits::_Load(_First);
+        auto _Cur_vals_min     = _First_vals; // vector of vertical minimum values
+        auto _Cur_vals_max     = _First_vals; // vector of vertical maximum values
+
+        const auto _Update_min_max = [&](const auto _Cur_vals) noexcept {
+            if constexpr ((_Mode & _Mode_min) != 0) {
+                if constexpr (_Sign) {
+                    _Cur_vals_min = _Traits::_Min(_Cur_vals_min, _Cur_vals);
+                } else {
+                    _Cur_vals_min = _Traits::_Min_u(_Cur_vals_min, _Cur_vals);
+                }
+            }
+
+            if constexpr ((_Mode & _Mode_max) != 0) {
+                if constexpr (_Sign) {
+                    _Cur_vals_max = _Traits::_Max(_Cur_vals_max, _Cur_vals);
+                } else {
+                    _Cur_vals_max = _Traits::_Max_u(_Cur_vals_max, _Cur_vals);
+                }
+            }
+        };
+
+        for (_Advance_bytes(_First, 64); _First != _Stop_at; _Advance_bytes(_First, 64)) {
+            _Update_min_max(_Traits::_Load(_First));
+        }
+
+        if (const size_t _Tail_byte_size = _Total_size_bytes & 0x3F; _Tail_byte_size != 0) {
+            _Update_min_max(_Traits::_Load_merge(_First_vals, _Tail_byte_size / sizeof(_Ty), _First));
+        }
+
+        _Ty _Cur_min_val{};
+        _Ty _Cur_max_val{};
+
+        if constexpr ((_Mode & _Mode_min) != 0) {
+            if constexpr (_Sign) {
+                _Cur_min_val = _Traits::_H_min(_Cur_vals_min);
+            } else {
+                _Cur_min_val = static_cast<_Ty>(_Traits::_H_min_u(_Cur_vals_min));
+            }
+        }
+
+        if constexpr ((_Mode & _Mode_max) != 0) {
+            if constexpr (_Sign) {
+                _Cur_max_val = _Traits::_H_max(_Cur_vals_max);
+            } else {
+                _Cur_max_val = static_cast<_Ty>(_Traits::_H_max_u(_Cur_vals_max));
+            }
+        }
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+
+        if constexpr (_Mode == _Mode_min) {
+            return _Cur_min_val;
+        } else if constexpr (_Mode == _Mode_max) {
+            return _Cur_max_val;
+        } else {
+            using _Rx = std::conditional_t<_Sign, typename _Traits::_Minmax_i_t, typename _Traits::_Minmax_u_t>;
+            return _Rx{_Cur_min_val, _Cur_max_val};
+        }
+    }
+
     // TRANSITION, DevCom-10767462
     template <_Min_max_mode _Mode, class _Traits, bool _Sign>
     auto __std_minmax_impl_wrap(const void* const _First, const void* const _Last) noexcept {
@@ -2235,6 +2608,10 @@ namespace {
     template <_Min_max_mode _Mode, class _Traits, bool _Sign>
     auto __std_minmax_disp(const void* const _First, const void* const _Last) noexcept {
 #ifndef _M_ARM64EC
+        if (_Byte_length(_First, _Last) >= 64 && _Use_avx512()) {
+            return __std_minmax_impl_avx512<_Mode, typename _Traits::_Avx512, _Sign>(_First, _Last);
+        }
+
         if (_Byte_length(_First, _Last) >= 32 && _Use_avx2()) {
             if constexpr (_Traits::_Avx::_Is_floating) {
                 return __std_minmax_impl_wrap<_Mode, typename _Traits::_Avx, _Sign>(_First, _Last);
@@ -2468,6 +2845,18 @@ __declspec(noalias) _Min_max_d __stdcall __std_minmax_d(const void* const _First
 namespace {
     struct _Find_traits_1 {
 #ifndef _M_ARM64EC
+        static __m512i _Set_avx512(const uint8_t _Val) noexcept {
+            return _mm512_set1_epi8(static_cast<char>(_Val));
+        }
+
+        static uint64_t _Cmp_avx512(const __m512i _Lhs, const __m512i _Rhs) noexcept {
+            return _mm512_cmpeq_epi8_mask(_Lhs, _Rhs);
+        }
+
+        static uint64_t _Cmp_ne_avx512(const __m512i _Lhs, const __m512i _Rhs) noexcept {
+            return _mm512_cmpneq_epi8_mask(_Lhs, _Rhs);
+        }
+
         static __m256i _Set_avx(const uint8_t _Val) noexcept {
             return _mm256_set1_epi8(_Val);
         }
@@ -2488,6 +2877,18 @@ namespace {
 
     struct _Find_traits_2 {
 #ifndef _M_ARM64EC
+        static __m512i _Set_avx512(const uint16_t _Val) noexcept {
+            return _mm512_set1_epi16(static_cast<short>(_Val));
+        }
+
+        static uint64_t _Cmp_avx512(const __m512i _Lhs, const __m512i _Rhs) noexcept {
+            return _mm512_cmpeq_epi16_mask(_Lhs, _Rhs);
+        }
+
+        static uint64_t _Cmp_ne_avx512(const __m512i _Lhs, const __m512i _Rhs) noexcept {
+            return _mm512_cmpneq_epi16_mask(_Lhs, _Rhs);
+        }
+
         static __m256i _Set_avx(const uint16_t _Val) noexcept {
             return _mm256_set1_epi16(_Val);
         }
@@ -2508,6 +2909,18 @@ namespace {
 
     struct _Find_traits_4 {
 #ifndef _M_ARM64EC
+        static __m512i _Set_avx512(const uint32_t _Val) noexcept {
+            return _mm512_set1_epi32(static_cast<int>(_Val));
+        }
+
+        static uint64_t _Cmp_avx512(const __m512i _Lhs, const __m512i _Rhs) noexcept {
+            return _mm512_cmpeq_epi32_mask(_Lhs, _Rhs);
+        }
+
+        static uint64_t _Cmp_ne_avx512(const __m512i _Lhs, const __m512i _Rhs) noexcept {
+            return _mm512_cmpneq_epi32_mask(_Lhs, _Rhs);
+        }
+
         static __m256i _Set_avx(const uint32_t _Val) noexcept {
             return _mm256_set1_epi32(_Val);
         }
@@ -2528,6 +2941,18 @@ namespace {
 
     struct _Find_traits_8 {
 #ifndef _M_ARM64EC
+        static __m512i _Set_avx512(const uint64_t _Val) noexcept {
+            return _mm512_set1_epi64(static_cast<long long>(_Val));
+        }
+
+        static uint64_t _Cmp_avx512(const __m512i _Lhs, const __m512i _Rhs) noexcept {
+            return _mm512_cmpeq_epi64_mask(_Lhs, _Rhs);
+        }
+
+        static uint64_t _Cmp_ne_avx512(const __m512i _Lhs, const __m512i _Rhs) noexcept {
+            return _mm512_cmpneq_epi64_mask(_Lhs, _Rhs);
+        }
+
         static __m256i _Set_avx(const uint64_t _Val) noexcept {
             return _mm256_set1_epi64x(_Val);
         }
@@ -2565,7 +2990,41 @@ namespace {
 #ifndef _M_ARM64EC
         const size_t _Size_bytes = _Byte_length(_First, _Last);
 
-        if (const size_t _Avx_size = _Size_bytes & ~size_t{0x1F}; _Avx_size != 0 && _Use_avx2()) {
+        if (const size_t _Avx512_size = _Size_bytes & ~size_t{0x3F}; _Avx512_size != 0 && _Use_avx512()) {
+            _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+            const __m512i _Comparand = _Traits::_Set_avx512(_Val);
+            const void* _Stop_at     = _First;
+            _Advance_bytes(_Stop_at, _Avx512_size);
+
+            do {
+                const __m512i _Data  = _mm512_loadu_si512(_First);
+                const uint64_t _Bingo = _Traits::_Cmp_avx512(_Data, _Comparand);
+
+                if (_Bingo != 0) {
+                    _Advance_bytes(_First, _Avx512_first_bit(_Bingo) * sizeof(_Ty));
+                    return _First;
+                }
+
+                _Advance_bytes(_First, 64);
+            } while (_First != _Stop_at);
+
+            if (const size_t _Tail_size = _Size_bytes & 0x3F; _Tail_size != 0) {
+                // masked-off bytes are neither read nor allowed to match
+                const __m512i _Data   = _mm512_maskz_loadu_epi8(_Avx512_tail_mask(_Tail_size), _First);
+                const uint64_t _Bingo =
+                    _Traits::_Cmp_avx512(_Data, _Comparand) & _Avx512_tail_mask(_Tail_size / sizeof(_Ty));
+
+                if (_Bingo != 0) {
+                    _Advance_bytes(_First, _Avx512_first_bit(_Bingo) * sizeof(_Ty));
+                    return _First;
+                }
+
+                _Advance_bytes(_First, _Tail_size);
+            }
+
+            return _First;
+        } else if (const size_t _Avx_size = _Size_bytes & ~size_t{0x1F}; _Avx_size != 0 && _Use_avx2()) {
             _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
 
             const __m256i _Comparand = _Traits::_Set_avx(_Val);
@@ -2637,7 +3096,39 @@ namespace {
 #ifndef _M_ARM64EC
         const size_t _Size_bytes = _Byte_length(_First, _Last);
 
-        if (const size_t _Avx_size = _Size_bytes & ~size_t{0x1F}; _Avx_size != 0 && _Use_avx2()) {
+        if (const size_t _Avx512_size = _Size_bytes & ~size_t{0x3F}; _Avx512_size != 0 && _Use_avx512()) {
+            _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+            const __m512i _Comparand = _Traits::_Set_avx512(_Val);
+            const void* _Stop_at     = _Last;
+            _Rewind_bytes(_Stop_at, _Avx512_size);
+
+            do {
+                _Rewind_bytes(_Last, 64);
+                const __m512i _Data   = _mm512_loadu_si512(_Last);
+                const uint64_t _Bingo = _Traits::_Cmp_avx512(_Data, _Comparand);
+
+                if (_Bingo != 0) {
+                    _Advance_bytes(_Last, _Avx512_last_bit(_Bingo) * sizeof(_Ty));
+                    return _Last;
+                }
+            } while (_Last != _Stop_at);
+
+            if (const size_t _Tail_size = _Size_bytes & 0x3F; _Tail_size != 0) {
+                // masked-off bytes are neither read nor allowed to match
+                _Rewind_bytes(_Last, _Tail_size);
+                const __m512i _Data   = _mm512_maskz_loadu_epi8(_Avx512_tail_mask(_Tail_size), _Last);
+                const uint64_t _Bingo =
+                    _Traits::_Cmp_avx512(_Data, _Comparand) & _Avx512_tail_mask(_Tail_size / sizeof(_Ty));
+
+                if (_Bingo != 0) {
+                    _Advance_bytes(_Last, _Avx512_last_bit(_Bingo) * sizeof(_Ty));
+                    return _Last;
+                }
+            }
+
+            return _Real_last;
+        } else if (const size_t _Avx_size = _Size_bytes & ~size_t{0x1F}; _Avx_size != 0 && _Use_avx2()) {
             _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
 
             const __m256i _Comparand = _Traits::_Set_avx(_Val);
@@ -2837,7 +3328,29 @@ namespace {
 #ifndef _M_ARM64EC
         const size_t _Size_bytes = _Byte_length(_First, _Last);
 
-        if (size_t _Avx_size = _Size_bytes & ~size_t{0x1F}; _Avx_size != 0 && _Use_avx2()) {
+        if (const size_t _Avx512_size = _Size_bytes & ~size_t{0x3F}; _Avx512_size != 0 && _Use_avx512()) {
+            // Comparisons produce bit masks, so one popcount per vector counts the matches; there are no packed
+            // counters that could overflow, and no need to split the range into portions.
+            const __m512i _Comparand = _Traits::_Set_avx512(_Val);
+            const void* _Stop_at     = _First;
+            _Advance_bytes(_Stop_at, _Avx512_size);
+
+            do {
+                const __m512i _Data = _mm512_loadu_si512(_First);
+                _Result += _Avx512_popcount(_Traits::_Cmp_avx512(_Data, _Comparand));
+                _Advance_bytes(_First, 64);
+            } while (_First != _Stop_at);
+
+            if (const size_t _Tail_size = _Size_bytes & 0x3F; _Tail_size != 0) {
+                // masked-off bytes are neither read nor allowed to match
+                const __m512i _Data = _mm512_maskz_loadu_epi8(_Avx512_tail_mask(_Tail_size), _First);
+                _Result += _Avx512_popcount(
+                    _Traits::_Cmp_avx512(_Data, _Comparand) & _Avx512_tail_mask(_Tail_size / sizeof(_Ty)));
+            }
+
+            _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+            return _Result;
+        } else if (size_t _Avx_size = _Size_bytes & ~size_t{0x1F}; _Avx_size != 0 && _Use_avx2()) {
             const __m256i _Comparand = _Traits::_Set_avx(_Val);
             const void* _Stop_at     = _First;
 
@@ -2930,6 +3443,8 @@ namespace {
         return _Result;
     }
 
+    enum class _Find_meow_of_predicate { _Any_of, _None_of };
+
 #ifndef _M_ARM64EC
     namespace __std_find_meow_of_bitmap_details {
         __m256i _Bitmap_step(const __m256i _Bitmap, const __m256i _Data) noexcept {
@@ -3042,6 +3557,16 @@ namespace {
                 return _Make_bitmap_large(_Needle_ptr, _Needle_length);
             }
         }
+
+        template <_Find_meow_of_predicate _Pred>
+        unsigned int _Bingo_from_mask(const __m256i _Mask) noexcept {
+            const unsigned int _In_needle = _mm256_movemask_ps(_mm256_castsi256_ps(_Mask));
+            if constexpr (_Pred == _Find_meow_of_predicate::_Any_of) {
+                return _In_needle;
+            } else {
+                return _In_needle ^ 0xFF;
+            }
+        }
     } // namespace __std_find_meow_of_bitmap_details
 #endif // !_M_ARM64EC
 
@@ -3181,15 +3706,15 @@ namespace {
                 const size_t _Byte_size = _Needle_length * sizeof(_Ty);
 
                 const void* _Stop = _Needle_ptr;
-                _Advance_bytes(_Stop, _Byte_size & ~size_t{0x1F});
-                for (; _Needle_ptr != _Stop; _Needle_ptr += 32 / sizeof(_Ty)) {
+                _Advance_bytes(_Stop, _Byte_size & ~size_t{0xF});
+                for (; _Needle_ptr != _Stop; _Needle_ptr += 16 / sizeof(_Ty)) {
                     const __m128i _Data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Needle_ptr));
                     if (!_mm_testz_si128(_Mask, _Data)) {
                         return false;
                     }
                 }
 
-                _Advance_bytes(_Stop, _Byte_size & 0x1E);
+                _Advance_bytes(_Stop, _Byte_size & 0xE);
                 for (; _Needle_ptr != _Stop; ++_Needle_ptr) {
                     if ((*_Needle_ptr & ~_Ty{0xFF}) != 0) {
                         return false;
@@ -3200,7 +3725,7 @@ namespace {
             }
         }
 
-        template <class _Ty>
+        template <class _Ty, _Find_meow_of_predicate _Pred>
         size_t _Impl_first_avx(const void* const _Haystack, const size_t _Haystack_length, const void* const _Needle,
             const size_t _Needle_length) noexcept {
             using namespace __std_find_meow_of_bitmap_details;
@@ -3216,7 +3741,7 @@ namespace {
             for (size_t _Ix = 0; _Ix != _Haystack_length_vec; _Ix += 8) {
                 const __m256i _Data       = _Load_avx_256_8(_Haystack_ptr + _Ix);
                 const __m256i _Mask       = _Mask_out_overflow<_Ty>(_Bitmap_step(_Bitmap, _Data), _Data);
-                const unsigned int _Bingo = _mm256_movemask_ps(_mm256_castsi256_ps(_Mask));
+                const unsigned int _Bingo = _Bingo_from_mask<_Pred>(_Mask);
                 if (_Bingo != 0) {
                     return _Ix + _tzcnt_u32(_Bingo);
                 }
@@ -3227,7 +3752,7 @@ namespace {
                 const unsigned int _Tail_bingo_mask = (1 << _Haystack_length_tail) - 1;
                 const __m256i _Data = _Load_avx_256_8_last(_Haystack_ptr + _Haystack_length_vec, _Haystack_length_tail);
                 const __m256i _Mask = _Mask_out_overflow<_Ty>(_Bitmap_step(_Bitmap, _Data), _Data);
-                const unsigned int _Bingo = _mm256_movemask_ps(_mm256_castsi256_ps(_Mask)) & _Tail_bingo_mask;
+                const unsigned int _Bingo = _Bingo_from_mask<_Pred>(_Mask) & _Tail_bingo_mask;
                 if (_Bingo != 0) {
                     return _Haystack_length_vec + _tzcnt_u32(_Bingo);
                 }
@@ -3236,7 +3761,7 @@ namespace {
             return static_cast<size_t>(-1);
         }
 
-        template <class _Ty>
+        template <class _Ty, _Find_meow_of_predicate _Pred>
         size_t _Impl_last_avx(const void* const _Haystack, size_t _Haystack_length, const void* const _Needle,
             const size_t _Needle_length) noexcept {
             using namespace __std_find_meow_of_bitmap_details;
@@ -3252,7 +3777,7 @@ namespace {
                 _Haystack_length -= 8;
                 const __m256i _Data       = _Load_avx_256_8(_Haystack_ptr + _Haystack_length);
                 const __m256i _Mask       = _Mask_out_overflow<_Ty>(_Bitmap_step(_Bitmap, _Data), _Data);
-                const unsigned int _Bingo = _mm256_movemask_ps(_mm256_castsi256_ps(_Mask));
+                const unsigned int _Bingo = _Bingo_from_mask<_Pred>(_Mask);
                 if (_Bingo != 0) {
                     return _Haystack_length + 31 - _lzcnt_u32(_Bingo);
                 }
@@ -3263,7 +3788,7 @@ namespace {
                 const unsigned int _Tail_bingo_mask = (1 << _Haystack_length_tail) - 1;
                 const __m256i _Data                 = _Load_avx_256_8_last(_Haystack_ptr, _Haystack_length_tail);
                 const __m256i _Mask                 = _Mask_out_overflow<_Ty>(_Bitmap_step(_Bitmap, _Data), _Data);
-                const unsigned int _Bingo           = _mm256_movemask_ps(_mm256_castsi256_ps(_Mask)) & _Tail_bingo_mask;
+                const unsigned int _Bingo           = _Bingo_from_mask<_Pred>(_Mask) & _Tail_bingo_mask;
                 if (_Bingo != 0) {
                     return 31 - _lzcnt_u32(_Bingo);
                 }
@@ -3309,9 +3834,11 @@ namespace {
         }
 #endif // !_M_ARM64EC
 
-        template <class _Ty>
+        template <class _Ty, _Find_meow_of_predicate _Pred>
         size_t _Impl_first_scalar(
             const void* const _Haystack, const size_t _Haystack_length, const _Scalar_table_t& _Table) noexcept {
+            constexpr bool _Match_in_table = _Pred == _Find_meow_of_predicate::_Any_of;
+
             const auto _Haystack_ptr = static_cast<const _Ty*>(_Haystack);
 
             for (size_t _Ix = 0; _Ix != _Haystack_length; ++_Ix) {
@@ -3319,11 +3846,15 @@ namespace {
 
                 if constexpr (sizeof(_Val) > 1) {
                     if (_Val >= 256) {
-                        continue;
+                        if constexpr (_Match_in_table) {
+                            continue;
+                        } else {
+                            return _Ix;
+                        }
                     }
                 }
 
-                if (_Table[_Val]) {
+                if (_Table[_Val] == _Match_in_table) {
                     return _Ix;
                 }
             }
@@ -3331,9 +3862,11 @@ namespace {
             return static_cast<size_t>(-1);
         }
 
-        template <class _Ty>
+        template <class _Ty, _Find_meow_of_predicate _Pred>
         size_t _Impl_last_scalar(
             const void* const _Haystack, size_t _Haystack_length, const _Scalar_table_t& _Table) noexcept {
+            constexpr bool _Match_in_table = _Pred == _Find_meow_of_predicate::_Any_of;
+
             const auto _Haystack_ptr = static_cast<const _Ty*>(_Haystack);
 
             while (_Haystack_length != 0) {
@@ -3343,11 +3876,15 @@ namespace {
 
                 if constexpr (sizeof(_Val) > 1) {
                     if (_Val >= 256) {
-                        continue;
+                        if constexpr (_Match_in_table) {
+                            continue;
+                        } else {
+                            return _Haystack_length;
+                        }
                     }
                 }
 
-                if (_Table[_Val]) {
+                if (_Table[_Val] == _Match_in_table) {
                     return _Haystack_length;
                 }
             }
@@ -3744,13 +4281,13 @@ namespace {
 
             if (_Strat == _Strategy::_Vector_bitmap) {
                 if (_Can_fit_256_bits_sse(static_cast<const _Ty*>(_First2), _Count2)) {
-                    return _Impl_first_avx<_Ty>(_First1, _Count1, _First2, _Count2);
+                    return _Impl_first_avx<_Ty, _Find_meow_of_predicate::_Any_of>(_First1, _Count1, _First2, _Count2);
                 }
             } else if (_Strat == _Strategy::_Scalar_bitmap) {
                 if (_Can_fit_256_bits_sse(static_cast<const _Ty*>(_First2), _Count2)) {
                     alignas(32) _Scalar_table_t _Table = {};
                     _Build_scalar_table_no_check<_Ty>(_First2, _Count2, _Table);
-                    return _Impl_first_scalar<_Ty>(_First1, _Count1, _Table);
+                    return _Impl_first_scalar<_Ty, _Find_meow_of_predicate::_Any_of>(_First1, _Count1, _Table);
                 }
             }
 
@@ -3771,13 +4308,13 @@ namespace {
 
             if (_Strat == _Strategy::_Vector_bitmap) {
                 if (_Can_fit_256_bits_sse(static_cast<const _Ty*>(_First2), _Count2)) {
-                    return _Impl_first_avx<_Ty>(_First1, _Count1, _First2, _Count2);
+                    return _Impl_first_avx<_Ty, _Find_meow_of_predicate::_Any_of>(_First1, _Count1, _First2, _Count2);
                 }
             } else if (_Strat == _Strategy::_Scalar_bitmap) {
                 if (_Can_fit_256_bits_sse(static_cast<const _Ty*>(_First2), _Count2)) {
                     alignas(32) _Scalar_table_t _Table = {};
                     _Build_scalar_table_no_check<_Ty>(_First2, _Count2, _Table);
-                    return _Impl_first_scalar<_Ty>(_First1, _Count1, _Table);
+                    return _Impl_first_scalar<_Ty, _Find_meow_of_predicate::_Any_of>(_First1, _Count1, _Table);
                 }
             }
 
@@ -3796,7 +4333,7 @@ namespace {
 
             _Scalar_table_t _Table = {};
             if (_Build_scalar_table<_Ty>(_First2, _Count2, _Table)) {
-                return _Impl_first_scalar<_Ty>(_First1, _Count1, _Table);
+                return _Impl_first_scalar<_Ty, _Find_meow_of_predicate::_Any_of>(_First1, _Count1, _Table);
             }
 
             const void* const _Last1 = static_cast<const _Ty*>(_First1) + _Count1;
@@ -3981,13 +4518,14 @@ namespace {
 
                 if (_Strat == _Strategy::_Vector_bitmap) {
                     if (_Can_fit_256_bits_sse(static_cast<const _Ty*>(_First2), _Count2)) {
-                        return _Impl_last_avx<_Ty>(_First1, _Count1, _First2, _Count2);
+                        return _Impl_last_avx<_Ty, _Find_meow_of_predicate::_Any_of>(
+                            _First1, _Count1, _First2, _Count2);
                     }
                 } else if (_Strat == _Strategy::_Scalar_bitmap) {
                     if (_Can_fit_256_bits_sse(static_cast<const _Ty*>(_First2), _Count2)) {
                         alignas(32) _Scalar_table_t _Table = {};
                         _Build_scalar_table_no_check<_Ty>(_First2, _Count2, _Table);
-                        return _Impl_last_scalar<_Ty>(_First1, _Count1, _Table);
+                        return _Impl_last_scalar<_Ty, _Find_meow_of_predicate::_Any_of>(_First1, _Count1, _Table);
                     }
                 }
 
@@ -3997,7 +4535,7 @@ namespace {
             {
                 alignas(32) _Scalar_table_t _Table = {};
                 if (_Build_scalar_table<_Ty>(_First2, _Count2, _Table)) {
-                    return _Impl_last_scalar<_Ty>(_First1, _Count1, _Table);
+                    return _Impl_last_scalar<_Ty, _Find_meow_of_predicate::_Any_of>(_First1, _Count1, _Table);
                 }
 
                 return _Fallback<_Ty>(_First1, _Count1, _First2, _Count2);
@@ -4005,6 +4543,306 @@ namespace {
         }
     } // namespace __std_find_last_of
 
+    namespace __std_find_not_of {
+        template <class _Ty>
+        size_t _Fallback_first(const void* const _Haystack, const size_t _Haystack_length,
+            const void* const _Needle, const size_t _Needle_length) noexcept {
+            const auto _Ptr_haystack = static_cast<const _Ty*>(_Haystack);
+            const auto _Needle_end   = static_cast<const _Ty*>(_Needle) + _Needle_length;
+
+            for (size_t _Pos = 0; _Pos != _Haystack_length; ++_Pos) {
+                auto _Ptr = static_cast<const _Ty*>(_Needle);
+                while (_Ptr != _Needle_end && *_Ptr != _Ptr_haystack[_Pos]) {
+                    ++_Ptr;
+                }
+
+                if (_Ptr == _Needle_end) {
+                    return _Pos;
+                }
+            }
+
+            return static_cast<size_t>(-1);
+        }
+
+        template <class _Ty>
+        size_t _Fallback_last(const void* const _Haystack, size_t _Haystack_length, const void* const _Needle,
+            const size_t _Needle_length) noexcept {
+            const auto _Ptr_haystack = static_cast<const _Ty*>(_Haystack);
+            const auto _Needle_end   = static_cast<const _Ty*>(_Needle) + _Needle_length;
+
+            while (_Haystack_length != 0) {
+                --_Haystack_length;
+
+                auto _Ptr = static_cast<const _Ty*>(_Needle);
+                while (_Ptr != _Needle_end && *_Ptr != _Ptr_haystack[_Haystack_length]) {
+                    ++_Ptr;
+                }
+
+                if (_Ptr == _Needle_end) {
+                    return _Haystack_length;
+                }
+            }
+
+            return static_cast<size_t>(-1);
+        }
+
+#ifndef _M_ARM64EC
+        // With a needle that fits in 16 bytes, a single pcmpestri with masked negative polarity
+        // finds the first or the last haystack element of each part that isn't in the needle.
+        template <class _Ty, int _Op_direction>
+        size_t _Impl_small_needle_sse(const void* const _Haystack, const size_t _Haystack_length,
+            const void* const _Needle, const size_t _Needle_length) noexcept {
+            constexpr int _Op = (sizeof(_Ty) == 1 ? _SIDD_UBYTE_OPS : _SIDD_UWORD_OPS) | _SIDD_CMP_EQUAL_ANY
+                              | _SIDD_MASKED_NEGATIVE_POLARITY | _Op_direction;
+            constexpr size_t _Part_size_el = 16 / sizeof(_Ty);
+            constexpr int _Part_size       = static_cast<int>(_Part_size_el);
+            constexpr bool _Forward        = _Op_direction == _SIDD_LEAST_SIGNIFICANT;
+
+            const int _Needle_length_el = static_cast<int>(_Needle_length);
+
+            alignas(16) uint8_t _Tmp2[16];
+            memcpy(_Tmp2, _Needle, _Needle_length * sizeof(_Ty));
+            const __m128i _Data2 = _mm_load_si128(reinterpret_cast<const __m128i*>(_Tmp2));
+
+            const auto _Haystack_ptr          = static_cast<const _Ty*>(_Haystack);
+            const size_t _Tail_length         = _Haystack_length & (_Part_size_el - 1);
+            const size_t _Haystack_length_vec = _Haystack_length - _Tail_length;
+
+            // the tail is at the end of the haystack when searching forward, and at the beginning otherwise
+            const size_t _Vec_start  = _Forward ? 0 : _Tail_length;
+            const size_t _Tail_start = _Forward ? _Haystack_length_vec : 0;
+
+            for (size_t _Step = 0; _Step != _Haystack_length_vec; _Step += _Part_size_el) {
+                const size_t _Ix = _Vec_start + (_Forward ? _Step : _Haystack_length_vec - _Part_size_el - _Step);
+                const __m128i _Data1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Haystack_ptr + _Ix));
+                if (_mm_cmpestrc(_Data2, _Needle_length_el, _Data1, _Part_size, _Op)) {
+                    return _Ix + _mm_cmpestri(_Data2, _Needle_length_el, _Data1, _Part_size, _Op);
+                }
+            }
+
+            if (_Tail_length != 0) {
+                const int _Tail_length_el = static_cast<int>(_Tail_length);
+
+                alignas(16) uint8_t _Tmp1[16];
+                memcpy(_Tmp1, _Haystack_ptr + _Tail_start, _Tail_length * sizeof(_Ty));
+                const __m128i _Data1 = _mm_load_si128(reinterpret_cast<const __m128i*>(_Tmp1));
+
+                if (_mm_cmpestrc(_Data2, _Needle_length_el, _Data1, _Tail_length_el, _Op)) {
+                    return _Tail_start + _mm_cmpestri(_Data2, _Needle_length_el, _Data1, _Tail_length_el, _Op);
+                }
+            }
+
+            return static_cast<size_t>(-1);
+        }
+
+        // Finds which elements of a 16-byte haystack part are in the needle, taking the needle 16 bytes at a time.
+        // pcmpestri can't tell that an element is absent from every part of a long needle, so this collects
+        // the equal-any bit masks of all the parts, and the callers invert the result.
+#pragma warning(push)
+#pragma warning(disable : 4324) // structure was padded due to alignment specifier
+        template <class _Ty>
+        class _Needle_matcher_sse {
+        public:
+            static constexpr size_t _Part_size_el = 16 / sizeof(_Ty);
+
+            _Needle_matcher_sse(const void* const _Needle, const size_t _Needle_length) noexcept
+                : _Needle_first(_Needle), _Needle_last(_Needle) {
+                const size_t _Needle_length_bytes = _Needle_length * sizeof(_Ty);
+                _Advance_bytes(_Needle_last, _Needle_length_bytes & ~size_t{0xF});
+
+                const size_t _Last_needle_length = _Needle_length_bytes & 0xF;
+                _Last_needle_length_el           = static_cast<int>(_Last_needle_length / sizeof(_Ty));
+
+                alignas(16) uint8_t _Tmp2[16];
+                memcpy(_Tmp2, _Needle_last, _Last_needle_length);
+                _Last_needle_val = _mm_load_si128(reinterpret_cast<const __m128i*>(_Tmp2));
+            }
+
+            // returns the bit mask of the first _Size1 elements of _Data1 that are equal to some needle element
+            unsigned int _In_needle(const __m128i _Data1, const size_t _Size1) const noexcept {
+                constexpr int _Op = (sizeof(_Ty) == 1 ? _SIDD_UBYTE_OPS : _SIDD_UWORD_OPS) | _SIDD_CMP_EQUAL_ANY
+                                  | _SIDD_BIT_MASK;
+                constexpr int _Part_size = static_cast<int>(_Part_size_el);
+
+                const int _Size1_el = static_cast<int>(_Size1);
+
+                __m128i _Found = _mm_setzero_si128();
+                for (const void* _Cur = _Needle_first; _Cur != _Needle_last; _Advance_bytes(_Cur, 16)) {
+                    const __m128i _Data2 = _mm_loadu_si128(static_cast<const __m128i*>(_Cur));
+                    _Found = _mm_or_si128(_Found, _mm_cmpestrm(_Data2, _Part_size, _Data1, _Size1_el, _Op));
+                }
+
+                if (_Last_needle_length_el != 0) {
+                    _Found = _mm_or_si128(
+                        _Found, _mm_cmpestrm(_Last_needle_val, _Last_needle_length_el, _Data1, _Size1_el, _Op));
+                }
+
+                return static_cast<unsigned int>(_mm_cvtsi128_si32(_Found));
+            }
+
+        private:
+            __m128i _Last_needle_val;
+            const void* _Needle_first;
+            const void* _Needle_last;
+            int _Last_needle_length_el;
+        };
+#pragma warning(pop)
+
+        template <class _Ty>
+        size_t _Impl_first_sse(const void* const _Haystack, const size_t _Haystack_length, const void* const _Needle,
+            const size_t _Needle_length) noexcept {
+            using _Matcher                 = _Needle_matcher_sse<_Ty>;
+            constexpr size_t _Part_size_el = _Matcher::_Part_size_el;
+            constexpr unsigned int _All    = (1u << _Part_size_el) - 1;
+
+            const auto _Haystack_ptr          = static_cast<const _Ty*>(_Haystack);
+            const size_t _Haystack_length_vec = _Haystack_length & ~(_Part_size_el - 1);
+
+            const _Matcher _Matcher_val(_Needle, _Needle_length);
+            unsigned long _Offset;
+
+            for (size_t _Ix = 0; _Ix != _Haystack_length_vec; _Ix += _Part_size_el) {
+                const __m128i _Data1      = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Haystack_ptr + _Ix));
+                const unsigned int _Bingo = _Matcher_val._In_needle(_Data1, _Part_size_el) ^ _All;
+                if (_BitScanForward(&_Offset, _Bingo)) {
+                    return _Ix + _Offset;
+                }
+            }
+
+            if (const size_t _Tail_length = _Haystack_length - _Haystack_length_vec; _Tail_length != 0) {
+                alignas(16) uint8_t _Tmp1[16];
+                memcpy(_Tmp1, _Haystack_ptr + _Haystack_length_vec, _Tail_length * sizeof(_Ty));
+                const __m128i _Data1 = _mm_load_si128(reinterpret_cast<const __m128i*>(_Tmp1));
+
+                const unsigned int _Tail_mask = (1u << _Tail_length) - 1;
+                const unsigned int _Bingo     = ~_Matcher_val._In_needle(_Data1, _Tail_length) & _Tail_mask;
+                if (_BitScanForward(&_Offset, _Bingo)) {
+                    return _Haystack_length_vec + _Offset;
+                }
+            }
+
+            return static_cast<size_t>(-1);
+        }
+
+        template <class _Ty>
+        size_t _Impl_last_sse(const void* const _Haystack, size_t _Haystack_length, const void* const _Needle,
+            const size_t _Needle_length) noexcept {
+            using _Matcher                 = _Needle_matcher_sse<_Ty>;
+            constexpr size_t _Part_size_el = _Matcher::_Part_size_el;
+            constexpr unsigned int _All    = (1u << _Part_size_el) - 1;
+
+            const auto _Haystack_ptr = static_cast<const _Ty*>(_Haystack);
+
+            const _Matcher _Matcher_val(_Needle, _Needle_length);
+            unsigned long _Offset;
+
+            while (_Haystack_length >= _Part_size_el) {
+                _Haystack_length -= _Part_size_el;
+                const __m128i _Data1 =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Haystack_ptr + _Haystack_length));
+                const unsigned int _Bingo = _Matcher_val._In_needle(_Data1, _Part_size_el) ^ _All;
+                if (_BitScanReverse(&_Offset, _Bingo)) {
+                    return _Haystack_length + _Offset;
+                }
+            }
+
+            if (_Haystack_length != 0) {
+                alignas(16) uint8_t _Tmp1[16];
+                memcpy(_Tmp1, _Haystack_ptr, _Haystack_length * sizeof(_Ty));
+                const __m128i _Data1 = _mm_load_si128(reinterpret_cast<const __m128i*>(_Tmp1));
+
+                const unsigned int _Tail_mask = (1u << _Haystack_length) - 1;
+                const unsigned int _Bingo     = ~_Matcher_val._In_needle(_Data1, _Haystack_length) & _Tail_mask;
+                if (_BitScanReverse(&_Offset, _Bingo)) {
+                    return _Offset;
+                }
+            }
+
+            return static_cast<size_t>(-1);
+        }
+#endif // !_M_ARM64EC
+
+        template <class _Ty>
+        size_t _Dispatch_pos_first(
+            const void* const _First1, const size_t _Count1, const void* const _First2, const size_t _Count2) noexcept {
+            using namespace __std_find_meow_of_bitmap;
+
+            constexpr auto _None_of = _Find_meow_of_predicate::_None_of;
+
+#ifndef _M_ARM64EC
+            if (_Use_sse42()) {
+                const auto _Strat = _Pick_strategy<_Ty>(_Count1, _Count2, _Use_avx2());
+
+                if (_Strat == _Strategy::_Vector_bitmap) {
+                    if (_Can_fit_256_bits_sse(static_cast<const _Ty*>(_First2), _Count2)) {
+                        return _Impl_first_avx<_Ty, _None_of>(_First1, _Count1, _First2, _Count2);
+                    }
+                } else if (_Strat == _Strategy::_Scalar_bitmap) {
+                    if (_Can_fit_256_bits_sse(static_cast<const _Ty*>(_First2), _Count2)) {
+                        alignas(32) _Scalar_table_t _Table = {};
+                        _Build_scalar_table_no_check<_Ty>(_First2, _Count2, _Table);
+                        return _Impl_first_scalar<_Ty, _None_of>(_First1, _Count1, _Table);
+                    }
+                }
+
+                if (_Count2 * sizeof(_Ty) <= 16) {
+                    return _Impl_small_needle_sse<_Ty, _SIDD_LEAST_SIGNIFICANT>(_First1, _Count1, _First2, _Count2);
+                }
+
+                return _Impl_first_sse<_Ty>(_First1, _Count1, _First2, _Count2);
+            } else
+#endif // !_M_ARM64EC
+            {
+                alignas(32) _Scalar_table_t _Table = {};
+                if (_Build_scalar_table<_Ty>(_First2, _Count2, _Table)) {
+                    return _Impl_first_scalar<_Ty, _None_of>(_First1, _Count1, _Table);
+                }
+
+                return _Fallback_first<_Ty>(_First1, _Count1, _First2, _Count2);
+            }
+        }
+
+        template <class _Ty>
+        size_t _Dispatch_pos_last(
+            const void* const _First1, const size_t _Count1, const void* const _First2, const size_t _Count2) noexcept {
+            using namespace __std_find_meow_of_bitmap;
+
+            constexpr auto _None_of = _Find_meow_of_predicate::_None_of;
+
+#ifndef _M_ARM64EC
+            if (_Use_sse42()) {
+                const auto _Strat = _Pick_strategy<_Ty>(_Count1, _Count2, _Use_avx2());
+
+                if (_Strat == _Strategy::_Vector_bitmap) {
+                    if (_Can_fit_256_bits_sse(static_cast<const _Ty*>(_First2), _Count2)) {
+                        return _Impl_last_avx<_Ty, _None_of>(_First1, _Count1, _First2, _Count2);
+                    }
+                } else if (_Strat == _Strategy::_Scalar_bitmap) {
+                    if (_Can_fit_256_bits_sse(static_cast<const _Ty*>(_First2), _Count2)) {
+                        alignas(32) _Scalar_table_t _Table = {};
+                        _Build_scalar_table_no_check<_Ty>(_First2, _Count2, _Table);
+                        return _Impl_last_scalar<_Ty, _None_of>(_First1, _Count1, _Table);
+                    }
+                }
+
+                if (_Count2 * sizeof(_Ty) <= 16) {
+                    return _Impl_small_needle_sse<_Ty, _SIDD_MOST_SIGNIFICANT>(_First1, _Count1, _First2, _Count2);
+                }
+
+                return _Impl_last_sse<_Ty>(_First1, _Count1, _First2, _Count2);
+            } else
+#endif // !_M_ARM64EC
+            {
+                alignas(32) _Scalar_table_t _Table = {};
+                if (_Build_scalar_table<_Ty>(_First2, _Count2, _Table)) {
+                    return _Impl_last_scalar<_Ty, _None_of>(_First1, _Count1, _Table);
+                }
+
+                return _Fallback_last<_Ty>(_First1, _Count1, _First2, _Count2);
+            }
+        }
+    } // namespace __std_find_not_of
+
     template <class _Traits, class _Ty>
     __declspec(noalias) size_t __stdcall __std_mismatch_impl(
         const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
@@ -4013,7 +4851,34 @@ namespace {
         const auto _First1_ch = static_cast<const char*>(_First1);
         const auto _First2_ch = static_cast<const char*>(_First2);
 
-        if (_Use_avx2()) {
+        if (_Count * sizeof(_Ty) >= 64 && _Use_avx512()) {
+            _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+            const size_t _Count_bytes             = _Count * sizeof(_Ty);
+            const size_t _Count_bytes_avx512_full = _Count_bytes & ~size_t{0x3F};
+
+            for (; _Result != _Count_bytes_avx512_full; _Result += 0x40) {
+                const __m512i _Elem1  = _mm512_loadu_si512(_First1_ch + _Result);
+                const __m512i _Elem2  = _mm512_loadu_si512(_First2_ch + _Result);
+                const uint64_t _Bingo = _Traits::_Cmp_ne_avx512(_Elem1, _Elem2);
+                if (_Bingo != 0) {
+                    return _Result / sizeof(_Ty) + _Avx512_first_bit(_Bingo);
+                }
+            }
+
+            if (const size_t _Count_tail = _Count_bytes & 0x3F; _Count_tail != 0) {
+                // masked-off bytes are zero in both vectors, so they never mismatch
+                const uint64_t _Tail_mask = _Avx512_tail_mask(_Count_tail);
+                const __m512i _Elem1      = _mm512_maskz_loadu_epi8(_Tail_mask, _First1_ch + _Result);
+                const __m512i _Elem2      = _mm512_maskz_loadu_epi8(_Tail_mask, _First2_ch + _Result);
+                const uint64_t _Bingo     = _Traits::_Cmp_ne_avx512(_Elem1, _Elem2);
+                if (_Bingo != 0) {
+                    return _Result / sizeof(_Ty) + _Avx512_first_bit(_Bingo);
+                }
+            }
+
+            return _Count;
+        } else if (_Use_avx2()) {
             _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
 
             const size_t _Count_bytes          = _Count * sizeof(_Ty);
@@ -4081,6 +4946,192 @@ namespace {
         return _Result;
     }
 
+#ifndef _M_ARM64EC
+    namespace __std_search_details {
+        // Generic SIMD substring search: a vector of candidate starts is compared with the needle's first element,
+        // and the vector (needle length - 1) elements further is compared with its last element.
+        // Only the candidates passing both are checked with memcmp, so long needles stay fast too.
+
+        template <class _Ty>
+        constexpr unsigned int _Elem_start_bits = sizeof(_Ty) == 1 ? 0xFFFF'FFFF
+                                                : sizeof(_Ty) == 2 ? 0x5555'5555
+                                                : sizeof(_Ty) == 4 ? 0x1111'1111
+                                                                   : 0x0101'0101;
+
+        template <class _Traits>
+        struct _Vec_avx {
+            static constexpr size_t _Vec_size       = 32;
+            static constexpr unsigned int _All_bits = 0xFFFF'FFFF;
+
+            template <class _Ty>
+            static __m256i _Set(const _Ty _Val) noexcept {
+                return _Traits::_Set_avx(_Val);
+            }
+
+            static unsigned int _Match(const void* const _Src_first, const void* const _Src_last,
+                const __m256i _First_val, const __m256i _Last_val) noexcept {
+                const __m256i _Data_first = _mm256_loadu_si256(static_cast<const __m256i*>(_Src_first));
+                const __m256i _Data_last  = _mm256_loadu_si256(static_cast<const __m256i*>(_Src_last));
+                const __m256i _Both       = _mm256_and_si256(
+                    _Traits::_Cmp_avx(_Data_first, _First_val), _Traits::_Cmp_avx(_Data_last, _Last_val));
+                return static_cast<unsigned int>(_mm256_movemask_epi8(_Both));
+            }
+
+            static void _Exit_vectorized() noexcept {
+                _mm256_zeroupper();
+            }
+        };
+
+        template <class _Traits>
+        struct _Vec_sse {
+            static constexpr size_t _Vec_size       = 16;
+            static constexpr unsigned int _All_bits = 0xFFFF;
+
+            template <class _Ty>
+            static __m128i _Set(const _Ty _Val) noexcept {
+                return _Traits::_Set_sse(_Val);
+            }
+
+            static unsigned int _Match(const void* const _Src_first, const void* const _Src_last,
+                const __m128i _First_val, const __m128i _Last_val) noexcept {
+                const __m128i _Data_first = _mm_loadu_si128(static_cast<const __m128i*>(_Src_first));
+                const __m128i _Data_last  = _mm_loadu_si128(static_cast<const __m128i*>(_Src_last));
+                const __m128i _Both       = _mm_and_si128(
+                    _Traits::_Cmp_sse(_Data_first, _First_val), _Traits::_Cmp_sse(_Data_last, _Last_val));
+                return static_cast<unsigned int>(_mm_movemask_epi8(_Both));
+            }
+
+            static void _Exit_vectorized() noexcept {}
+        };
+
+        template <class _Vec_traits, class _Ty>
+        bool _Fits(const size_t _Size_bytes_1, const size_t _Size_bytes_2) noexcept {
+            // There must be at least a whole vector of candidate starts.
+            return _Size_bytes_1 - _Size_bytes_2 >= _Vec_traits::_Vec_size - sizeof(_Ty);
+        }
+
+        template <class _Vec_traits, class _Ty>
+        const void* _Search(const void* _First1, const void* const _Last1, const void* const _First2,
+            const size_t _Size_bytes_2) noexcept {
+            // pre: _Fits<_Vec_traits, _Ty> and the needle has at least two elements
+            const auto _Ptr2          = static_cast<const _Ty*>(_First2);
+            const size_t _Count2      = _Size_bytes_2 / sizeof(_Ty);
+            const size_t _Last_offset = _Size_bytes_2 - sizeof(_Ty);
+            const size_t _Mid_bytes_2 = _Size_bytes_2 - 2 * sizeof(_Ty);
+            const auto _First_val     = _Vec_traits::_Set(_Ptr2[0]);
+            const auto _Last_val      = _Vec_traits::_Set(_Ptr2[_Count2 - 1]);
+            unsigned int _Unchecked   = _Vec_traits::_All_bits;
+
+            // The last step is moved back to end exactly at the last candidate start.
+            const void* _Stop1 = _Last1;
+            _Rewind_bytes(_Stop1, _Last_offset + _Vec_traits::_Vec_size);
+
+            for (;;) {
+                const void* _Src_last = _First1;
+                _Advance_bytes(_Src_last, _Last_offset);
+
+                unsigned int _Bingo =
+                    _Vec_traits::_Match(_First1, _Src_last, _First_val, _Last_val) & _Unchecked & _Elem_start_bits<_Ty>;
+
+                while (_Bingo != 0) {
+                    unsigned long _Offset;
+                    // CodeQL [SM02313] _Offset is always initialized: we just tested that _Bingo is non-zero.
+                    _BitScanForward(&_Offset, _Bingo);
+
+                    const void* _Candidate = _First1;
+                    _Advance_bytes(_Candidate, _Offset);
+
+                    const void* _Mid1 = _Candidate;
+                    _Advance_bytes(_Mid1, sizeof(_Ty));
+
+                    if (memcmp(_Mid1, _Ptr2 + 1, _Mid_bytes_2) == 0) {
+                        _Vec_traits::_Exit_vectorized();
+                        return _Candidate;
+                    }
+
+                    _Bingo &= _Bingo - 1;
+                }
+
+                if (_First1 == _Stop1) {
+                    break;
+                }
+
+                const size_t _Left = _Byte_length(_First1, _Stop1);
+                if (_Left >= _Vec_traits::_Vec_size) {
+                    _Advance_bytes(_First1, _Vec_traits::_Vec_size);
+                } else {
+                    // Don't check again the candidates covered by this step.
+                    _Unchecked = _Vec_traits::_All_bits << (_Vec_traits::_Vec_size - _Left);
+                    _First1    = _Stop1;
+                }
+            }
+
+            _Vec_traits::_Exit_vectorized();
+            return _Last1;
+        }
+
+        template <class _Vec_traits, class _Ty>
+        const void* _Find_end(const void* const _First1, const void* const _Last1, const void* const _First2,
+            const size_t _Size_bytes_2) noexcept {
+            // pre: _Fits<_Vec_traits, _Ty> and the needle has at least two elements
+            const auto _Ptr2          = static_cast<const _Ty*>(_First2);
+            const size_t _Count2      = _Size_bytes_2 / sizeof(_Ty);
+            const size_t _Last_offset = _Size_bytes_2 - sizeof(_Ty);
+            const size_t _Mid_bytes_2 = _Size_bytes_2 - 2 * sizeof(_Ty);
+            const auto _First_val     = _Vec_traits::_Set(_Ptr2[0]);
+            const auto _Last_val      = _Vec_traits::_Set(_Ptr2[_Count2 - 1]);
+            unsigned int _Unchecked   = _Vec_traits::_All_bits;
+
+            // The first step ends exactly at the last candidate start.
+            const void* _Mid1 = _Last1;
+            _Rewind_bytes(_Mid1, _Last_offset + _Vec_traits::_Vec_size);
+
+            for (;;) {
+                const void* _Src_last = _Mid1;
+                _Advance_bytes(_Src_last, _Last_offset);
+
+                unsigned int _Bingo =
+                    _Vec_traits::_Match(_Mid1, _Src_last, _First_val, _Last_val) & _Unchecked & _Elem_start_bits<_Ty>;
+
+                while (_Bingo != 0) {
+                    unsigned long _Offset;
+                    // CodeQL [SM02313] _Offset is always initialized: we just tested that _Bingo is non-zero.
+                    _BitScanReverse(&_Offset, _Bingo);
+
+                    const void* _Candidate = _Mid1;
+                    _Advance_bytes(_Candidate, _Offset);
+
+                    const void* _Mid_candidate = _Candidate;
+                    _Advance_bytes(_Mid_candidate, sizeof(_Ty));
+
+                    if (memcmp(_Mid_candidate, _Ptr2 + 1, _Mid_bytes_2) == 0) {
+                        _Vec_traits::_Exit_vectorized();
+                        return _Candidate;
+                    }
+
+                    _Bingo ^= 1u << _Offset;
+                }
+
+                if (_Mid1 == _First1) {
+                    break;
+                }
+
+                const size_t _Left = _Byte_length(_First1, _Mid1);
+                if (_Left >= _Vec_traits::_Vec_size) {
+                    _Rewind_bytes(_Mid1, _Vec_traits::_Vec_size);
+                } else {
+                    // Don't check again the candidates covered by this step.
+                    _Unchecked = (1u << _Left) - 1;
+                    _Mid1      = _First1;
+                }
+            }
+
+            _Vec_traits::_Exit_vectorized();
+            return _Last1;
+        }
+    } // namespace __std_search_details
+#endif // !defined(_M_ARM64EC)
+
     template <class _Traits, class _Ty>
     const void* __stdcall __std_search_impl(
         const void* _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
@@ -4100,7 +5151,18 @@ namespace {
         }
 
 #ifndef _M_ARM64EC
-        if (_Use_sse42() && _Size_bytes_1 >= 16) {
+        using _Avx = __std_search_details::_Vec_avx<_Traits>;
+        using _Sse = __std_search_details::_Vec_sse<_Traits>;
+
+        if (__std_search_details::_Fits<_Avx, _Ty>(_Size_bytes_1, _Size_bytes_2) && _Use_avx2()) {
+            return __std_search_details::_Search<_Avx, _Ty>(_First1, _Last1, _First2, _Size_bytes_2);
+        }
+
+        if constexpr (sizeof(_Ty) > 2) {
+            if (__std_search_details::_Fits<_Sse, _Ty>(_Size_bytes_1, _Size_bytes_2) && _Use_sse42()) {
+                return __std_search_details::_Search<_Sse, _Ty>(_First1, _Last1, _First2, _Size_bytes_2);
+            }
+        } else if (_Use_sse42() && _Size_bytes_1 >= 16) {
             constexpr int _Op = (sizeof(_Ty) == 1 ? _SIDD_UBYTE_OPS : _SIDD_UWORD_OPS) | _SIDD_CMP_EQUAL_ORDERED;
             constexpr int _Part_size_el = sizeof(_Ty) == 1 ? 16 : 8;
 
@@ -4197,37 +5259,36 @@ namespace {
             }
 
             return _Last1;
-        } else
+        }
 #endif // !defined(_M_ARM64EC)
-        {
-            const size_t _Max_pos = _Size_bytes_1 - _Size_bytes_2 + sizeof(_Ty);
 
-            auto _Ptr1         = static_cast<const _Ty*>(_First1);
-            const auto _Ptr2   = static_cast<const _Ty*>(_First2);
-            const void* _Stop1 = _Ptr1;
-            _Advance_bytes(_Stop1, _Max_pos);
+        const size_t _Max_pos = _Size_bytes_1 - _Size_bytes_2 + sizeof(_Ty);
 
-            for (; _Ptr1 != _Stop1; ++_Ptr1) {
-                if (*_Ptr1 != *_Ptr2) {
-                    continue;
-                }
+        auto _Ptr1         = static_cast<const _Ty*>(_First1);
+        const auto _Ptr2   = static_cast<const _Ty*>(_First2);
+        const void* _Stop1 = _Ptr1;
+        _Advance_bytes(_Stop1, _Max_pos);
 
-                bool _Equal = true;
+        for (; _Ptr1 != _Stop1; ++_Ptr1) {
+            if (*_Ptr1 != *_Ptr2) {
+                continue;
+            }
 
-                for (size_t _Idx = 1; _Idx != _Count2; ++_Idx) {
-                    if (_Ptr1[_Idx] != _Ptr2[_Idx]) {
-                        _Equal = false;
-                        break;
-                    }
-                }
+            bool _Equal = true;
 
-                if (_Equal) {
-                    return _Ptr1;
+            for (size_t _Idx = 1; _Idx != _Count2; ++_Idx) {
+                if (_Ptr1[_Idx] != _Ptr2[_Idx]) {
+                    _Equal = false;
+                    break;
                 }
             }
 
-            return _Last1;
+            if (_Equal) {
+                return _Ptr1;
+            }
         }
+
+        return _Last1;
     }
 
     template <class _Traits, class _Ty>
@@ -4249,7 +5310,18 @@ namespace {
         }
 
 #ifndef _M_ARM64EC
-        if (_Use_sse42() && _Size_bytes_1 >= 16) {
+        using _Avx = __std_search_details::_Vec_avx<_Traits>;
+        using _Sse = __std_search_details::_Vec_sse<_Traits>;
+
+        if (__std_search_details::_Fits<_Avx, _Ty>(_Size_bytes_1, _Size_bytes_2) && _Use_avx2()) {
+            return __std_search_details::_Find_end<_Avx, _Ty>(_First1, _Last1, _First2, _Size_bytes_2);
+        }
+
+        if constexpr (sizeof(_Ty) > 2) {
+            if (__std_search_details::_Fits<_Sse, _Ty>(_Size_bytes_1, _Size_bytes_2) && _Use_sse42()) {
+                return __std_search_details::_Find_end<_Sse, _Ty>(_First1, _Last1, _First2, _Size_bytes_2);
+            }
+        } else if (_Use_sse42() && _Size_bytes_1 >= 16) {
             constexpr int _Op = (sizeof(_Ty) == 1 ? _SIDD_UBYTE_OPS : _SIDD_UWORD_OPS) | _SIDD_CMP_EQUAL_ORDERED;
             constexpr int _Part_size_el = sizeof(_Ty) == 1 ? 16 : 8;
 
@@ -4345,7 +5417,8 @@ namespace {
                     _Mid1                         = _First1;
                     const __m128i _Data1          = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Mid1));
                     const auto _Match             = _mm_cmpestrm(_Data2, _Size_el_2, _Data1, _Part_size_el, _Op);
-                    const unsigned int _Match_val = _mm_cvtsi128_si32(_Match) & ((1 << _Tail_bytes_1) - 1);
+                    const unsigned int _Match_val =
+                        _mm_cvtsi128_si32(_Match) & ((1 << (_Tail_bytes_1 / sizeof(_Ty))) - 1);
                     if (_Match_val != 0 && (_Check_unfit(_Match_val) || _Check_fit(_Match_val))) {
                         return _Mid1;
                     }
@@ -4437,7 +5510,8 @@ namespace {
                     _Mid1                         = _First1;
                     const __m128i _Data1          = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Mid1));
                     const auto _Match             = _mm_cmpestrm(_Data2, _Part_size_el, _Data1, _Part_size_el, _Op);
-                    const unsigned int _Match_val = _mm_cvtsi128_si32(_Match) & ((1 << _Tail_bytes_1) - 1);
+                    const unsigned int _Match_val =
+                        _mm_cvtsi128_si32(_Match) & ((1 << (_Tail_bytes_1 / sizeof(_Ty))) - 1);
                     if (_Match_val != 0 && _Check(_Match_val)) {
                         return _Mid1;
                     }
@@ -4445,34 +5519,33 @@ namespace {
 
                 return _Last1;
             }
-        } else
+        }
 #endif // !defined(_M_ARM64EC)
-        {
-            auto _Ptr1       = static_cast<const _Ty*>(_Last1) - _Count2;
-            const auto _Ptr2 = static_cast<const _Ty*>(_First2);
 
-            for (;;) {
-                if (*_Ptr1 == *_Ptr2) {
-                    bool _Equal = true;
+        auto _Ptr1       = static_cast<const _Ty*>(_Last1) - _Count2;
+        const auto _Ptr2 = static_cast<const _Ty*>(_First2);
 
-                    for (size_t _Idx = 1; _Idx != _Count2; ++_Idx) {
-                        if (_Ptr1[_Idx] != _Ptr2[_Idx]) {
-                            _Equal = false;
-                            break;
-                        }
-                    }
+        for (;;) {
+            if (*_Ptr1 == *_Ptr2) {
+                bool _Equal = true;
 
-                    if (_Equal) {
-                        return _Ptr1;
+                for (size_t _Idx = 1; _Idx != _Count2; ++_Idx) {
+                    if (_Ptr1[_Idx] != _Ptr2[_Idx]) {
+                        _Equal = false;
+                        break;
                     }
                 }
 
-                if (_Ptr1 == _First1) {
-                    return _Last1;
+                if (_Equal) {
+                    return _Ptr1;
                 }
+            }
 
-                --_Ptr1;
+            if (_Ptr1 == _First1) {
+                return _Last1;
             }
+
+            --_Ptr1;
         }
     }
 } // unnamed namespace
@@ -4609,6 +5682,26 @@ __declspec(noalias) size_t __stdcall __std_find_last_of_trivial_pos_2(const void
     return __std_find_last_of::_Dispatch_pos<uint16_t>(_Haystack, _Haystack_length, _Needle, _Needle_length);
 }
 
+__declspec(noalias) size_t __stdcall __std_find_first_not_of_trivial_pos_1(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return __std_find_not_of::_Dispatch_pos_first<uint8_t>(_Haystack, _Haystack_length, _Needle, _Needle_length);
+}
+
+__declspec(noalias) size_t __stdcall __std_find_first_not_of_trivial_pos_2(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return __std_find_not_of::_Dispatch_pos_first<uint16_t>(_Haystack, _Haystack_length, _Needle, _Needle_length);
+}
+
+__declspec(noalias) size_t __stdcall __std_find_last_not_of_trivial_pos_1(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return __std_find_not_of::_Dispatch_pos_last<uint8_t>(_Haystack, _Haystack_length, _Needle, _Needle_length);
+}
+
+__declspec(noalias) size_t __stdcall __std_find_last_not_of_trivial_pos_2(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return __std_find_not_of::_Dispatch_pos_last<uint16_t>(_Haystack, _Haystack_length, _Needle, _Needle_length);
+}
+
 const void* __stdcall __std_search_1(
     const void* const _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
     return __std_search_impl<_Find_traits_1, uint8_t>(_First1, _Last1, _First2, _Count2);
@@ -4619,6 +5712,16 @@ const void* __stdcall __std_search_2(
     return __std_search_impl<_Find_traits_2, uint16_t>(_First1, _Last1, _First2, _Count2);
 }
 
+const void* __stdcall __std_search_4(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
+    return __std_search_impl<_Find_traits_4, uint32_t>(_First1, _Last1, _First2, _Count2);
+}
+
+const void* __stdcall __std_search_8(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
+    return __std_search_impl<_Find_traits_8, uint64_t>(_First1, _Last1, _First2, _Count2);
+}
+
 const void* __stdcall __std_find_end_1(
     const void* const _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
     return __std_find_end_impl<_Find_traits_1, uint8_t>(_First1, _Last1, _First2, _Count2);
@@ -4629,6 +5732,16 @@ const void* __stdcall __std_find_end_2(
     return __std_find_end_impl<_Find_traits_2, uint16_t>(_First1, _Last1, _First2, _Count2);
 }
 
+const void* __stdcall __std_find_end_4(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
+    return __std_find_end_impl<_Find_traits_4, uint32_t>(_First1, _Last1, _First2, _Count2);
+}
+
+const void* __stdcall __std_find_end_8(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
+    return __std_find_end_impl<_Find_traits_8, uint64_t>(_First1, _Last1, _First2, _Count2);
+}
+
 __declspec(noalias) size_t __stdcall __std_mismatch_1(
     const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
     return __std_mismatch_impl<_Find_traits_1, uint8_t>(_First1, _First2, _Count);
@@ -4943,429 +6056,2562 @@ void* __stdcall __std_remove_8(void* _First, void* const _Last, const uint64_t _
 } // extern "C"
 
 namespace {
-    namespace __std_bitset_to_string {
-#ifdef _M_ARM64EC
-        using _Traits_1_avx = void;
-        using _Traits_1_sse = void;
-        using _Traits_2_avx = void;
-        using _Traits_2_sse = void;
-#else // ^^^ defined(_M_ARM64EC) / !defined(_M_ARM64EC) vvv
-        struct _Traits_1_avx {
-            using _Value_type = uint32_t;
-
-            static __m256i _Set(const char _Val) noexcept {
-                return _mm256_broadcastb_epi8(_mm_cvtsi32_si128(_Val));
-            }
+    namespace __std_sort {
+        // Sorting is an introsort, like std::sort: quicksort partitioning, a dedicated sort for small ranges,
+        // and heap sort when partitioning does not make enough progress. The vectorized implementation partitions
+        // a vector at a time in place, and sorts small ranges with a bitonic sorting network over up to four vectors.
+        // Floating-point ranges have NaNs moved to the end first, so everything else is totally ordered.
+
+        template <class _Ty, size_t _Lanes, bool _Is_floating>
+        struct _Sort_traits_base {
+            using _Value_type = _Ty;
+
+            static constexpr size_t _Vec_lanes    = _Lanes;
+            static constexpr bool _Floating       = _Is_floating;
+            static constexpr size_t _Dwords       = sizeof(_Ty) / 4;
+            static constexpr size_t _Small_scalar = 32; // insertion sort threshold, like _ISORT_MAX
+        };
 
-            static __m256i __forceinline _Step(const uint32_t _Val, const __m256i _Px0, const __m256i _Px1) noexcept {
-                const __m128i _Vx0 = _mm_cvtsi32_si128(_Val);
-                const __m128i _Vx1 =
-                    _mm_shuffle_epi8(_Vx0, _mm_set_epi32(0x00000000, 0x01010101, 0x02020202, 0x03030303));
-                const __m256i _Vx2 = _mm256_castsi128_si256(_Vx1);
-                const __m256i _Vx3 = _mm256_permutevar8x32_epi32(_Vx2, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
-                const __m256i _Msk = _mm256_and_si256(_Vx3, _mm256_set1_epi64x(0x0102040810204080));
-                const __m256i _Ex0 = _mm256_cmpeq_epi8(_Msk, _mm256_setzero_si256());
-                const __m256i _Ex1 = _mm256_blendv_epi8(_Px1, _Px0, _Ex0);
-                return _Ex1;
-            }
+        struct _Sort_traits_4i_base : _Sort_traits_base<int32_t, 8, false> {
+            static constexpr int32_t _Fill = static_cast<int32_t>(0x7FFF'FFFFUL); // pads partial vectors, sorts last
+        };
 
-            static void _Out(void* _Dest, const __m256i _Elems) noexcept {
-                _mm256_storeu_si256(static_cast<__m256i*>(_Dest), _Elems);
-            }
+        struct _Sort_traits_4u_base : _Sort_traits_base<uint32_t, 8, false> {
+            static constexpr uint32_t _Fill = 0xFFFF'FFFFUL;
         };
 
-        struct _Traits_1_sse {
-            using _Value_type = uint16_t;
+        struct _Sort_traits_8i_base : _Sort_traits_base<int64_t, 4, false> {
+            static constexpr int64_t _Fill = static_cast<int64_t>(0x7FFF'FFFF'FFFF'FFFFULL);
+        };
 
-            static __m128i _Set(const char _Val) noexcept {
-                return _mm_shuffle_epi8(_mm_cvtsi32_si128(_Val), _mm_setzero_si128());
-            }
+        struct _Sort_traits_8u_base : _Sort_traits_base<uint64_t, 4, false> {
+            static constexpr uint64_t _Fill = 0xFFFF'FFFF'FFFF'FFFFULL;
+        };
 
-            static __m128i __forceinline _Step(const uint16_t _Val, const __m128i _Px0, const __m128i _Px1) noexcept {
-                const __m128i _Vx0 = _mm_cvtsi32_si128(_Val);
-                const __m128i _Vx1 =
-                    _mm_shuffle_epi8(_Vx0, _mm_set_epi32(0x00000000, 0x00000000, 0x01010101, 0x01010101));
-                const __m128i _Msk = _mm_and_si128(_Vx1, _mm_set1_epi64x(0x0102040810204080));
-                const __m128i _Ex0 = _mm_cmpeq_epi8(_Msk, _mm_setzero_si128());
-                const __m128i _Ex1 = _mm_blendv_epi8(_Px1, _Px0, _Ex0);
-                return _Ex1;
-            }
+        struct _Sort_traits_f_base : _Sort_traits_base<float, 8, true> {
+            static constexpr float _Fill = __builtin_huge_valf();
+        };
 
-            static void _Out(void* _Dest, const __m128i _Elems) noexcept {
-                _mm_storeu_si128(static_cast<__m128i*>(_Dest), _Elems);
-            }
+        struct _Sort_traits_d_base : _Sort_traits_base<double, 4, true> {
+            static constexpr double _Fill = __builtin_huge_val();
         };
 
-        struct _Traits_2_avx {
-            using _Value_type = uint16_t;
+        template <class _Ty, class _Pr>
+        _Ty* _Partition_scalar(_Ty* _First, _Ty* _Last, _Pr _Goes_right) noexcept {
+            // moves the elements satisfying _Goes_right after the others, returning the boundary
+            for (;;) {
+                for (;;) {
+                    if (_First == _Last) {
+                        return _First;
+                    }
 
-            static __m256i _Set(const wchar_t _Val) noexcept {
-                return _mm256_broadcastw_epi16(_mm_cvtsi32_si128(_Val));
-            }
+                    if (_Goes_right(*_First)) {
+                        break;
+                    }
 
-            static __m256i __forceinline _Step(const uint16_t _Val, const __m256i _Px0, const __m256i _Px1) noexcept {
-                const __m128i _Vx0 = _mm_cvtsi32_si128(_Val);
-                const __m128i _Vx1 =
-                    _mm_shuffle_epi8(_Vx0, _mm_set_epi32(0x00000000, 0x00000000, 0x01010101, 0x01010101));
-                const __m256i _Vx2 = _mm256_castsi128_si256(_Vx1);
-                const __m256i _Vx3 = _mm256_permute4x64_epi64(_Vx2, _MM_SHUFFLE(1, 1, 0, 0));
-                const __m256i _Msk = _mm256_and_si256(_Vx3,
-                    _mm256_set_epi64x(0x0001000200040008, 0x0010002000400080, 0x0001000200040008, 0x0010002000400080));
-                const __m256i _Ex0 = _mm256_cmpeq_epi16(_Msk, _mm256_setzero_si256());
-                const __m256i _Ex1 = _mm256_blendv_epi8(_Px1, _Px0, _Ex0);
-                return _Ex1;
+                    ++_First;
+                }
+
+                do {
+                    --_Last;
+                    if (_First == _Last) {
+                        return _First;
+                    }
+                } while (_Goes_right(*_Last));
+
+                const _Ty _Tmp = *_First;
+                *_First        = *_Last;
+                *_Last         = _Tmp;
+                ++_First;
             }
+        }
 
-            static void _Out(void* _Dest, const __m256i _Elems) noexcept {
-                _mm256_storeu_si256(static_cast<__m256i*>(_Dest), _Elems);
+        template <class _Ty>
+        void _Insertion_sort(_Ty* const _First, _Ty* const _Last) noexcept {
+            if (_First == _Last) {
+                return;
             }
-        };
 
-        struct _Traits_2_sse {
-            using _Value_type = uint8_t;
+            for (_Ty* _Mid = _First + 1; _Mid != _Last; ++_Mid) {
+                const _Ty _Val = *_Mid;
+                _Ty* _Hole     = _Mid;
 
-            static __m128i _Set(const wchar_t _Val) noexcept {
-                return _mm_set1_epi16(_Val);
-            }
+                if (_Val < *_First) { // found new earliest element, move to front
+                    for (; _Hole != _First; --_Hole) {
+                        *_Hole = *(_Hole - 1);
+                    }
+                } else { // look for insertion point after first
+                    for (; _Val < *(_Hole - 1); --_Hole) {
+                        *_Hole = *(_Hole - 1);
+                    }
+                }
 
-            static __m128i __forceinline _Step(const uint8_t _Val, const __m128i _Px0, const __m128i _Px1) noexcept {
-                const __m128i _Vx  = _mm_set1_epi16(_Val);
-                const __m128i _Msk = _mm_and_si128(_Vx, _mm_set_epi64x(0x0001000200040008, 0x0010002000400080));
-                const __m128i _Ex0 = _mm_cmpeq_epi16(_Msk, _mm_setzero_si128());
-                const __m128i _Ex1 = _mm_blendv_epi8(_Px1, _Px0, _Ex0);
-                return _Ex1;
+                *_Hole = _Val;
             }
+        }
 
-            static void _Out(void* _Dest, const __m128i _Elems) noexcept {
-                _mm_storeu_si128(static_cast<__m128i*>(_Dest), _Elems);
-            }
-        };
+        template <class _Ty>
+        void _Heap_sort(_Ty* const _First, const size_t _Size) noexcept {
+            const auto _Sift_down = [_First](size_t _Hole, const size_t _Bottom) noexcept {
+                const _Ty _Val = _First[_Hole];
+                for (size_t _Child = 2 * _Hole + 1; _Child < _Bottom; _Child = 2 * _Hole + 1) {
+                    if (_Child + 1 < _Bottom && _First[_Child] < _First[_Child + 1]) {
+                        ++_Child;
+                    }
 
-        template <class _Traits, class _Elem>
-        void __stdcall _Impl(
-            _Elem* const _Dest, const void* _Src, size_t _Size_bits, const _Elem _Elem0, const _Elem _Elem1) noexcept {
-            constexpr size_t _Step_size_bits = sizeof(_Traits::_Value_type) * 8;
+                    if (!(_Val < _First[_Child])) {
+                        break;
+                    }
 
-            const auto _Px0 = _Traits::_Set(_Elem0);
-            const auto _Px1 = _Traits::_Set(_Elem1);
-            if (_Size_bits >= _Step_size_bits) {
-                _Elem* _Pos = _Dest + _Size_bits;
-                _Size_bits &= _Step_size_bits - 1;
-                _Elem* const _Stop_at = _Dest + _Size_bits;
-                do {
-                    typename _Traits::_Value_type _Val;
-                    memcpy(&_Val, _Src, sizeof(_Val));
-                    const auto _Elems = _Traits::_Step(_Val, _Px0, _Px1);
-                    _Pos -= _Step_size_bits;
-                    _Traits::_Out(_Pos, _Elems);
-                    _Advance_bytes(_Src, sizeof(_Val));
-                } while (_Pos != _Stop_at);
+                    _First[_Hole] = _First[_Child];
+                    _Hole         = _Child;
+                }
+
+                _First[_Hole] = _Val;
+            };
+
+            for (size_t _Hole = _Size / 2; _Hole != 0;) {
+                --_Hole;
+                _Sift_down(_Hole, _Size);
             }
 
-            if (_Size_bits > 0) {
-                __assume(_Size_bits < sizeof(_Traits::_Value_type));
-                typename _Traits::_Value_type _Val;
-                memcpy(&_Val, _Src, sizeof(_Val));
-                const auto _Elems = _Traits::_Step(_Val, _Px0, _Px1);
-                _Elem _Tmp[_Step_size_bits];
-                _Traits::_Out(_Tmp, _Elems);
-                const _Elem* const _Tmpd = _Tmp + (_Step_size_bits - _Size_bits);
-                memcpy(_Dest, _Tmpd, _Size_bits * sizeof(_Elem));
+            for (size_t _Bottom = _Size; _Bottom > 1;) {
+                --_Bottom;
+                const _Ty _Tmp = _First[_Bottom];
+                _First[_Bottom] = _First[0];
+                _First[0]       = _Tmp;
+                _Sift_down(0, _Bottom);
             }
         }
-#endif // ^^^ !defined(_M_ARM64EC) ^^^
 
-        template <class _Avx_traits, class _Sse_traits, class _Elem>
-        void __stdcall _Dispatch(_Elem* const _Dest, const void* const _Src, const size_t _Size_bits,
-            const _Elem _Elem0, const _Elem _Elem1) noexcept {
-#ifndef _M_ARM64EC
-            if (_Use_avx2() && _Size_bits >= 256) {
-                _Impl<_Avx_traits>(_Dest, _Src, _Size_bits, _Elem0, _Elem1);
-                _mm256_zeroupper(); // TRANSITION, DevCom-10331414
-            } else if (_Use_sse42()) {
-                _Impl<_Sse_traits>(_Dest, _Src, _Size_bits, _Elem0, _Elem1);
-            } else
-#endif // !defined(_M_ARM64EC)
-            {
-                const auto _Arr = reinterpret_cast<const uint8_t*>(_Src);
-                for (size_t _Ix = 0; _Ix < _Size_bits; ++_Ix) {
-                    _Dest[_Size_bits - 1 - _Ix] = ((_Arr[_Ix >> 3] >> (_Ix & 7)) & 1) != 0 ? _Elem1 : _Elem0;
-                }
+        template <class _Ty>
+        _Ty _Median_of_three(const _Ty _Val1, const _Ty _Val2, const _Ty _Val3) noexcept {
+            if (_Val2 < _Val1) {
+                return _Val3 < _Val2 ? _Val2 : (_Val3 < _Val1 ? _Val3 : _Val1);
+            } else {
+                return _Val3 < _Val1 ? _Val1 : (_Val3 < _Val2 ? _Val3 : _Val2);
             }
         }
-    } // namespace __std_bitset_to_string
-} // unnamed namespace
 
-extern "C" {
+        template <class _Ty>
+        _Ty _Guess_median(const _Ty* const _First, const size_t _Size) noexcept {
+            const size_t _Mid   = _Size / 2;
+            const size_t _Last  = _Size - 1;
+            const size_t _Step  = _Size / 8;
+            const _Ty _Median_1 = _Median_of_three(_First[0], _First[_Step], _First[2 * _Step]);
+            const _Ty _Median_2 = _Median_of_three(_First[_Mid - _Step], _First[_Mid], _First[_Mid + _Step]);
+            const _Ty _Median_3 = _Median_of_three(_First[_Last - 2 * _Step], _First[_Last - _Step], _First[_Last]);
+            return _Median_of_three(_Median_1, _Median_2, _Median_3);
+        }
 
-__declspec(noalias) void __stdcall __std_bitset_to_string_1(
-    char* const _Dest, const void* const _Src, const size_t _Size_bits, const char _Elem0, const char _Elem1) noexcept {
-    using namespace __std_bitset_to_string;
-    _Dispatch<_Traits_1_avx, _Traits_1_sse>(_Dest, _Src, _Size_bits, _Elem0, _Elem1);
-}
+        template <class _Base>
+        struct _Sort_traits_scalar : _Base {
+            using _Ty = typename _Base::_Value_type;
 
-__declspec(noalias) void __stdcall __std_bitset_to_string_2(wchar_t* const _Dest, const void* const _Src,
-    const size_t _Size_bits, const wchar_t _Elem0, const wchar_t _Elem1) noexcept {
-    using namespace __std_bitset_to_string;
-    _Dispatch<_Traits_2_avx, _Traits_2_sse>(_Dest, _Src, _Size_bits, _Elem0, _Elem1);
-}
+            static constexpr size_t _Small_size = _Base::_Small_scalar;
 
-} // extern "C"
+            static void _Small_sort(_Ty* const _First, const size_t _Size) noexcept {
+                _Insertion_sort(_First, _First + _Size);
+            }
 
-namespace {
+            template <bool _Equal_goes_right>
+            static _Ty* _Partition(_Ty* const _First, _Ty* const _Last, const _Ty _Pivot) noexcept {
+                if constexpr (_Equal_goes_right) {
+                    return _Partition_scalar(_First, _Last, [_Pivot](const _Ty _Val) { return !(_Val < _Pivot); });
+                } else {
+                    return _Partition_scalar(_First, _Last, [_Pivot](const _Ty _Val) { return _Pivot < _Val; });
+                }
+            }
+        };
 
-    namespace __std_bitset_from_string {
+        template <class _Impl, class _Ty>
+        void _Introsort(_Ty* _First, _Ty* _Last, ptrdiff_t _Ideal) noexcept {
+            for (;;) {
+                const size_t _Size = static_cast<size_t>(_Last - _First);
+                if (_Size <= _Impl::_Small_size) {
+                    _Impl::_Small_sort(_First, _Size);
+                    return;
+                }
 
-#ifdef _M_ARM64EC
-        using _Traits_1_avx = void;
-        using _Traits_1_sse = void;
-        using _Traits_2_avx = void;
-        using _Traits_2_sse = void;
-#else // ^^^ defined(_M_ARM64EC) / !defined(_M_ARM64EC) vvv
-        struct _Traits_avx {
-            using _Vec = __m256i;
+                if (_Ideal <= 0) { // heap sort if too many divisions
+                    _Heap_sort(_First, _Size);
+                    return;
+                }
 
-            static __m256i _Load(const void* _Src) noexcept {
-                return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src));
+                _Ideal = (_Ideal >> 1) + (_Ideal >> 2); // allow 1.5 log2(N) divisions
+
+                const _Ty _Pivot = _Guess_median(_First, _Size);
+                _Ty* const _Mid  = _Impl::template _Partition<false>(_First, _Last, _Pivot);
+
+                if (_Mid == _Last) {
+                    // Nothing is greater than the pivot. Elements equal to it are the greatest ones, so after moving
+                    // them to the end they are in their final place; the pivot is one of them, so this progresses.
+                    _Last = _Impl::template _Partition<true>(_First, _Last, _Pivot);
+                } else if (_Mid - _First < _Last - _Mid) { // loop on second half
+                    _Introsort<_Impl>(_First, _Mid, _Ideal);
+                    _First = _Mid;
+                } else { // loop on first half
+                    _Introsort<_Impl>(_Mid, _Last, _Ideal);
+                    _Last = _Mid;
+                }
             }
+        }
 
-            static void _Store(void* _Dest, const __m256i _Val) noexcept {
-                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest), _Val);
+#ifndef _M_ARM64EC
+        struct _Network_tables {
+            int32_t _Perm[6][8]; // partner lanes of each compare-exchange step, as dword indices
+            int32_t _Max[6][8]; // lanes that keep the greater value at each step
+            int32_t _Reverse[8];
+        };
+
+        constexpr _Network_tables _Make_network_tables(const uint32_t _Lanes) {
+            // Bitonic sort of one vector: for each block size _Kx, compare-exchange at distances _Kx / 2 .. 1.
+            // The steps with _Kx == _Lanes are the ones that turn a bitonic vector into a sorted one.
+            const uint32_t _Dwords = 8 / _Lanes;
+            _Network_tables _Result{};
+            uint32_t _Step = 0;
+            for (uint32_t _Kx = 2; _Kx <= _Lanes; _Kx *= 2) {
+                for (uint32_t _Jx = _Kx / 2; _Jx != 0; _Jx /= 2, ++_Step) {
+                    for (uint32_t _Ix = 0; _Ix != _Lanes; ++_Ix) {
+                        const bool _Takes_max = ((_Ix & _Jx) != 0) != ((_Ix & _Kx) != 0);
+                        for (uint32_t _Dx = 0; _Dx != _Dwords; ++_Dx) {
+                            const uint32_t _Lane = _Ix * _Dwords + _Dx;
+                            _Result._Perm[_Step][_Lane] = static_cast<int32_t>((_Ix ^ _Jx) * _Dwords + _Dx);
+                            _Result._Max[_Step][_Lane]  = _Takes_max ? -1 : 0;
+                        }
+                    }
+                }
             }
 
-            static bool _Check(const __m256i _Val, const __m256i _Ex1, const __m256i _Dx0) noexcept {
-                return _mm256_testc_si256(_Ex1, _mm256_xor_si256(_Val, _Dx0));
+            for (uint32_t _Ix = 0; _Ix != 8; ++_Ix) {
+                _Result._Reverse[_Ix] = static_cast<int32_t>((_Lanes - 1 - _Ix / _Dwords) * _Dwords + _Ix % _Dwords);
             }
+
+            return _Result;
+        }
+
+        template <size_t _Size_v>
+        struct _Partition_tables {
+            uint8_t _Shuf[_Size_v][8];
+            uint8_t _Left_count[_Size_v];
         };
 
-        struct _Traits_sse {
-            using _Vec = __m128i;
+        template <size_t _Size_v>
+        constexpr auto _Make_partition_tables(const uint32_t _Lanes) {
+            // Make vpermd indices corresponding to a bit mask of the lanes that go right: the other lanes are moved to
+            // the bottom and these to the top, both keeping their order.
+            const uint32_t _Dwords = 8 / _Lanes;
+            _Partition_tables<_Size_v> _Result{};
+            for (uint32_t _Vx = 0; _Vx != _Size_v; ++_Vx) {
+                uint32_t _Nx = 0;
+                for (uint32_t _Pass = 0; _Pass != 2; ++_Pass) {
+                    for (uint32_t _Hx = 0; _Hx != _Lanes; ++_Hx) {
+                        if (((_Vx >> _Hx) & 1) == _Pass) {
+                            for (uint32_t _Dx = 0; _Dx != _Dwords; ++_Dx) {
+                                _Result._Shuf[_Vx][_Nx * _Dwords + _Dx] = static_cast<uint8_t>(_Hx * _Dwords + _Dx);
+                            }
+                            ++_Nx;
+                        }
+                    }
 
-            static __m128i _Load(const void* _Src) noexcept {
-                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src));
+                    if (_Pass == 0) {
+                        _Result._Left_count[_Vx] = static_cast<uint8_t>(_Nx);
+                    }
+                }
             }
 
-            static void _Store(void* _Dest, const __m128i _Val) noexcept {
-                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest), _Val);
+            return _Result;
+        }
+
+        constexpr auto _Network_tables_4 = _Make_network_tables(8);
+        constexpr auto _Network_tables_8 = _Make_network_tables(4);
+
+        constexpr auto _Partition_tables_4 = _Make_partition_tables<256>(8);
+        constexpr auto _Partition_tables_8 = _Make_partition_tables<16>(4);
+
+        struct _Sort_traits_4i_avx : _Sort_traits_4i_base {
+            static __m256i _Set(const int32_t _Val) noexcept {
+                return _mm256_set1_epi32(_Val);
             }
 
-            static bool _Check(const __m128i _Val, const __m128i _Ex1, const __m128i _Dx0) noexcept {
-                return _mm_testc_si128(_Ex1, _mm_xor_si128(_Val, _Dx0));
+            static __m256i _Min(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                return _mm256_min_epi32(_Lhs, _Rhs);
+            }
+
+            static __m256i _Max(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                return _mm256_max_epi32(_Lhs, _Rhs);
+            }
+
+            static unsigned int _Gt_mask(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                const __m256i _Gt = _mm256_cmpgt_epi32(_Lhs, _Rhs);
+                return static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(_Gt)));
             }
         };
 
-        struct _Traits_1_avx : _Traits_avx {
-            using _Word = uint32_t;
+        struct _Sort_traits_4u_avx : _Sort_traits_4u_base {
+            static __m256i _Set(const uint32_t _Val) noexcept {
+                return _mm256_set1_epi32(static_cast<int>(_Val));
+            }
 
-            static __m256i _Set(const char _Val) noexcept {
-                return _mm256_set1_epi8(_Val);
+            static __m256i _Min(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                return _mm256_min_epu32(_Lhs, _Rhs);
             }
 
-            static uint32_t _To_bits(const __m256i _Ex1) noexcept {
-                const __m256i _Shuf = _mm256_set_epi8( //
-                    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, //
-                    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            static __m256i _Max(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                return _mm256_max_epu32(_Lhs, _Rhs);
+            }
 
-                const __m256i _Ex2 = _mm256_shuffle_epi8(_Ex1, _Shuf);
-                return _rotl(static_cast<uint32_t>(_mm256_movemask_epi8(_Ex2)), 16);
+            static unsigned int _Gt_mask(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                const __m256i _Sign = _mm256_set1_epi32(static_cast<int>(0x8000'0000UL));
+                return _Sort_traits_4i_avx::_Gt_mask(_mm256_xor_si256(_Lhs, _Sign), _mm256_xor_si256(_Rhs, _Sign));
             }
+        };
 
-            static __m256i _Cmp(const __m256i _Val, const __m256i _Dx1) noexcept {
-                return _mm256_cmpeq_epi8(_Val, _Dx1);
+        struct _Sort_traits_8i_avx : _Sort_traits_8i_base {
+            static __m256i _Set(const int64_t _Val) noexcept {
+                return _mm256_set1_epi64x(_Val);
+            }
+
+            static __m256i _Min(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                return _mm256_blendv_epi8(_Lhs, _Rhs, _mm256_cmpgt_epi64(_Lhs, _Rhs));
+            }
+
+            static __m256i _Max(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                return _mm256_blendv_epi8(_Rhs, _Lhs, _mm256_cmpgt_epi64(_Lhs, _Rhs));
+            }
+
+            static unsigned int _Gt_mask(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                const __m256i _Gt = _mm256_cmpgt_epi64(_Lhs, _Rhs);
+                return static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(_Gt)));
             }
         };
 
-        struct _Traits_1_sse : _Traits_sse {
-            using _Word = uint16_t;
+        struct _Sort_traits_8u_avx : _Sort_traits_8u_base {
+            static __m256i _Set(const uint64_t _Val) noexcept {
+                return _mm256_set1_epi64x(static_cast<long long>(_Val));
+            }
 
-            static __m128i _Set(const char _Val) noexcept {
-                return _mm_shuffle_epi8(_mm_cvtsi32_si128(_Val), _mm_setzero_si128());
+            static __m256i _Gt(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                const __m256i _Sign = _mm256_set1_epi64x(static_cast<long long>(0x8000'0000'0000'0000ULL));
+                return _mm256_cmpgt_epi64(_mm256_xor_si256(_Lhs, _Sign), _mm256_xor_si256(_Rhs, _Sign));
             }
 
-            static uint16_t _To_bits(const __m128i _Ex1) noexcept {
-                const __m128i _Shuf = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
-                const __m128i _Ex2  = _mm_shuffle_epi8(_Ex1, _Shuf);
-                return static_cast<uint16_t>(_mm_movemask_epi8(_Ex2));
+            static __m256i _Min(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                return _mm256_blendv_epi8(_Lhs, _Rhs, _Gt(_Lhs, _Rhs));
             }
 
-            static __m128i _Cmp(const __m128i _Val, const __m128i _Dx1) noexcept {
-                return _mm_cmpeq_epi8(_Val, _Dx1);
+            static __m256i _Max(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                return _mm256_blendv_epi8(_Rhs, _Lhs, _Gt(_Lhs, _Rhs));
+            }
+
+            static unsigned int _Gt_mask(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                return static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(_Gt(_Lhs, _Rhs))));
             }
         };
 
-        struct _Traits_2_avx : _Traits_avx {
-            using _Word = uint16_t;
+        struct _Sort_traits_f_avx : _Sort_traits_f_base {
+            static __m256i _Set(const float _Val) noexcept {
+                return _mm256_castps_si256(_mm256_set1_ps(_Val));
+            }
 
-            static __m256i _Set(const wchar_t _Val) noexcept {
-                return _mm256_set1_epi16(_Val);
+            static __m256i _Key(const __m256i _Val) noexcept {
+                // Flip the magnitude bits of negative values, so that signed integer order is value order with
+                // -0.0 before +0.0. vminps and vmaxps return the same operand for +0.0 and -0.0, which would lose
+                // one of them; distinct keys keep every compare-exchange a permutation.
+                return _mm256_xor_si256(_Val, _mm256_srli_epi32(_mm256_srai_epi32(_Val, 31), 1));
             }
 
-            static uint16_t _To_bits(const __m256i _Ex1) noexcept {
-                const __m256i _Shuf = _mm256_set_epi8( //
-                    +0, +2, +4, +6, +8, 10, 12, 14, -1, -1, -1, -1, -1, -1, -1, -1, //
-                    -1, -1, -1, -1, -1, -1, -1, -1, +0, +2, +4, +6, +8, 10, 12, 14);
+            static __m256i _Min(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                return _mm256_blendv_epi8(_Lhs, _Rhs, _mm256_cmpgt_epi32(_Key(_Lhs), _Key(_Rhs)));
+            }
 
-                const __m256i _Ex2 = _mm256_shuffle_epi8(_Ex1, _Shuf);
-                return static_cast<uint16_t>(_rotl(static_cast<uint32_t>(_mm256_movemask_epi8(_Ex2)), 8));
+            static __m256i _Max(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                return _mm256_blendv_epi8(_Rhs, _Lhs, _mm256_cmpgt_epi32(_Key(_Lhs), _Key(_Rhs)));
             }
 
-            static __m256i _Cmp(const __m256i _Val, const __m256i _Dx1) noexcept {
-                return _mm256_cmpeq_epi16(_Val, _Dx1);
+            static unsigned int _Gt_mask(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                const __m256 _Gt = _mm256_cmp_ps(_mm256_castsi256_ps(_Lhs), _mm256_castsi256_ps(_Rhs), _CMP_GT_OQ);
+                return static_cast<unsigned int>(_mm256_movemask_ps(_Gt));
             }
         };
 
-        struct _Traits_2_sse : _Traits_sse {
-            using _Word = uint8_t;
+        struct _Sort_traits_d_avx : _Sort_traits_d_base {
+            static __m256i _Set(const double _Val) noexcept {
+                return _mm256_castpd_si256(_mm256_set1_pd(_Val));
+            }
 
-            static __m128i _Set(const wchar_t _Val) noexcept {
-                return _mm_set1_epi16(_Val);
+            static __m256i _Key(const __m256i _Val) noexcept {
+                // as for float; AVX2 has no 64-bit arithmetic shift, so spread the high dword's sign instead
+                const __m256i _Sign = _mm256_shuffle_epi32(_mm256_srai_epi32(_Val, 31), _MM_SHUFFLE(3, 3, 1, 1));
+                return _mm256_xor_si256(_Val, _mm256_srli_epi64(_Sign, 1));
             }
 
-            static uint8_t _To_bits(const __m128i _Ex1) noexcept {
-                const __m128i _Shuf = _mm_set_epi8(-1, -1, -1, -1, -1, -1, -1, -1, 0, 2, 4, 6, 8, 10, 12, 14);
-                const __m128i _Ex2  = _mm_shuffle_epi8(_Ex1, _Shuf);
-                return static_cast<uint8_t>(_mm_movemask_epi8(_Ex2));
+            static __m256i _Min(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                return _mm256_blendv_epi8(_Lhs, _Rhs, _mm256_cmpgt_epi64(_Key(_Lhs), _Key(_Rhs)));
             }
 
-            static __m128i _Cmp(const __m128i _Val, const __m128i _Dx1) noexcept {
-                return _mm_cmpeq_epi16(_Val, _Dx1);
+            static __m256i _Max(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                return _mm256_blendv_epi8(_Rhs, _Lhs, _mm256_cmpgt_epi64(_Key(_Lhs), _Key(_Rhs)));
+            }
+
+            static unsigned int _Gt_mask(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                const __m256d _Gt = _mm256_cmp_pd(_mm256_castsi256_pd(_Lhs), _mm256_castsi256_pd(_Rhs), _CMP_GT_OQ);
+                return static_cast<unsigned int>(_mm256_movemask_pd(_Gt));
             }
         };
 
-        template <class _Traits, class _Elem, class _OutFn>
-        bool _Loop(const _Elem* const _Src, const _Elem* _Src_end, const typename _Traits::_Vec _Dx0,
-            const typename _Traits::_Vec _Dx1, _OutFn _Out) noexcept {
-            for (;;) {
-                typename _Traits::_Vec _Val;
-                constexpr size_t _Per_vec = sizeof(_Val) / sizeof(_Elem);
+        template <class _Traits>
+        struct _Sort_avx : _Traits {
+            using _Ty = typename _Traits::_Value_type;
 
-                if (const size_t _Left = _Src_end - _Src; _Left >= _Per_vec) {
-                    _Src_end -= _Per_vec;
-                    _Val = _Traits::_Load(_Src_end);
-                } else if (_Left == 0) {
-                    return true;
+            static constexpr size_t _Lanes      = _Traits::_Vec_lanes;
+            static constexpr size_t _Max_vecs   = 4;
+            static constexpr size_t _Small_size = _Max_vecs * _Lanes;
+
+            static constexpr size_t _Log2_lanes    = _Lanes == 8 ? 3 : 2;
+            static constexpr size_t _Network_steps = _Log2_lanes * (_Log2_lanes + 1) / 2;
+
+            static constexpr const _Network_tables& _Network = _Lanes == 8 ? _Network_tables_4 : _Network_tables_8;
+
+            static constexpr const auto& _Partition_table() noexcept {
+                if constexpr (_Lanes == 8) {
+                    return _Partition_tables_4;
                 } else {
-                    _Src_end = _Src;
-                    _Elem _Tmp[_Per_vec];
-                    _Traits::_Store(_Tmp, _Dx0);
-                    _Elem* const _Tmpd = _Tmp + (_Per_vec - _Left);
-                    _CSTD memcpy(_Tmpd, _Src_end, _Left * sizeof(_Elem));
-                    _Val = _Traits::_Load(_Tmp);
+                    return _Partition_tables_8;
                 }
+            }
 
-                const auto _Ex1 = _Traits::_Cmp(_Val, _Dx1);
+            static __m256i _Load_table(const int32_t* const _Src) noexcept {
+                return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src));
+            }
 
-                if (!_Traits::_Check(_Val, _Ex1, _Dx0)) {
-                    return false;
+            static __m256i _Network_step(const __m256i _Val, const size_t _Step) noexcept {
+                const __m256i _Partner = _mm256_permutevar8x32_epi32(_Val, _Load_table(_Network._Perm[_Step]));
+                return _mm256_blendv_epi8(
+                    _Traits::_Min(_Val, _Partner), _Traits::_Max(_Val, _Partner), _Load_table(_Network._Max[_Step]));
+            }
+
+            static __m256i _Sort_vec(__m256i _Val) noexcept {
+                for (size_t _Step = 0; _Step != _Network_steps; ++_Step) {
+                    _Val = _Network_step(_Val, _Step);
                 }
 
-                _Out(_Ex1);
+                return _Val;
             }
-        }
 
-        template <class _Traits, class _Elem>
-        bool _Impl(void* const _Dest, const _Elem* const _Src, const size_t _Size_bytes, const size_t _Size_bits,
-            const size_t _Size_chars, const _Elem _Elem0, const _Elem _Elem1) noexcept {
-            const auto _Dx0 = _Traits::_Set(_Elem0);
-            const auto _Dx1 = _Traits::_Set(_Elem1);
+            static __m256i _Sort_bitonic_vec(__m256i _Val) noexcept {
+                for (size_t _Step = _Network_steps - _Log2_lanes; _Step != _Network_steps; ++_Step) {
+                    _Val = _Network_step(_Val, _Step);
+                }
 
-            auto _Dst_words      = reinterpret_cast<_Traits::_Word*>(_Dest);
-            void* _Dst_words_end = _Dst_words;
-            _Advance_bytes(_Dst_words_end, _Size_bytes);
+                return _Val;
+            }
 
-            auto _Out = [&_Dst_words](const _Traits::_Vec _Ex1) {
-                *_Dst_words = _Traits::_To_bits(_Ex1);
-                ++_Dst_words;
-            };
+            static __m256i _Reverse_vec(const __m256i _Val) noexcept {
+                return _mm256_permutevar8x32_epi32(_Val, _Load_table(_Network._Reverse));
+            }
 
-            const size_t _Size_convert = (_Size_chars <= _Size_bits) ? _Size_chars : _Size_bits;
+            template <size_t _Vecs>
+            static void _Small_sort_n(_Ty* const _First, const size_t _Size) noexcept {
+                // Lanes past the end are filled with the greatest value, so they sort last and are not stored back.
+                const __m256i _Fill = _Traits::_Set(_Traits::_Fill);
+                __m256i _Vals[_Vecs];
+
+                for (size_t _Vx = 0; _Vx != _Vecs; ++_Vx) {
+                    const size_t _Offset = _Vx * _Lanes;
+                    if (_Offset + _Lanes <= _Size) {
+                        _Vals[_Vx] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_First + _Offset));
+                    } else if (_Offset < _Size) {
+                        const __m256i _Mask = _Avx2_tail_mask_32((_Size - _Offset) * _Traits::_Dwords);
+                        const __m256i _Data =
+                            _mm256_maskload_epi32(reinterpret_cast<const int*>(_First + _Offset), _Mask);
+                        _Vals[_Vx] = _mm256_blendv_epi8(_Fill, _Data, _Mask);
+                    } else {
+                        _Vals[_Vx] = _Fill;
+                    }
 
-            // Convert characters to bits
-            if (!_Loop<_Traits>(_Src, _Src + _Size_convert, _Dx0, _Dx1, _Out)) {
-                return false;
-            }
+                    _Vals[_Vx] = _Sort_vec(_Vals[_Vx]);
+                }
 
-            // Verify remaining characters, if any
-            if (_Size_convert != _Size_chars
-                && !_Loop<_Traits>(_Src + _Size_convert, _Src + _Size_chars, _Dx0, _Dx1, [](_Traits::_Vec) {})) {
-                return false;
+                // Merge sorted runs of _Width vectors pairwise. Reversing the second run makes the pair bitonic,
+                // then compare-exchanges at halving distances sort it.
+                for (size_t _Width = 1; _Width != _Vecs; _Width *= 2) {
+                    for (size_t _Base = 0; _Base != _Vecs; _Base += 2 * _Width) {
+                        for (size_t _Vx = 0; _Vx != _Width / 2; ++_Vx) {
+                            const __m256i _Tmp                 = _Vals[_Base + _Width + _Vx];
+                            _Vals[_Base + _Width + _Vx]        = _Vals[_Base + 2 * _Width - 1 - _Vx];
+                            _Vals[_Base + 2 * _Width - 1 - _Vx] = _Tmp;
+                        }
+
+                        for (size_t _Vx = _Base + _Width; _Vx != _Base + 2 * _Width; ++_Vx) {
+                            _Vals[_Vx] = _Reverse_vec(_Vals[_Vx]);
+                        }
+
+                        for (size_t _Dist = _Width; _Dist != 0; _Dist /= 2) {
+                            for (size_t _Vx = _Base; _Vx != _Base + 2 * _Width; ++_Vx) {
+                                if (((_Vx - _Base) & _Dist) == 0) {
+                                    const __m256i _Lo   = _Traits::_Min(_Vals[_Vx], _Vals[_Vx + _Dist]);
+                                    _Vals[_Vx + _Dist] = _Traits::_Max(_Vals[_Vx], _Vals[_Vx + _Dist]);
+                                    _Vals[_Vx]          = _Lo;
+                                }
+                            }
+                        }
+
+                        for (size_t _Vx = _Base; _Vx != _Base + 2 * _Width; ++_Vx) {
+                            _Vals[_Vx] = _Sort_bitonic_vec(_Vals[_Vx]);
+                        }
+                    }
+                }
+
+                for (size_t _Vx = 0; _Vx != _Vecs; ++_Vx) {
+                    const size_t _Offset = _Vx * _Lanes;
+                    if (_Offset + _Lanes <= _Size) {
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(_First + _Offset), _Vals[_Vx]);
+                    } else if (_Offset < _Size) {
+                        const __m256i _Mask = _Avx2_tail_mask_32((_Size - _Offset) * _Traits::_Dwords);
+                        _mm256_maskstore_epi32(reinterpret_cast<int*>(_First + _Offset), _Mask, _Vals[_Vx]);
+                    }
+                }
             }
 
-            // Trim tail (may be padding tail, or too short string, or both)
-            if (_Dst_words != _Dst_words_end) {
-                _CSTD memset(_Dst_words, 0, _Byte_length(_Dst_words, _Dst_words_end));
+            static void _Small_sort(_Ty* const _First, const size_t _Size) noexcept {
+                if (_Size <= _Lanes) {
+                    _Small_sort_n<1>(_First, _Size);
+                } else if (_Size <= 2 * _Lanes) {
+                    _Small_sort_n<2>(_First, _Size);
+                } else {
+                    _Small_sort_n<4>(_First, _Size);
+                }
             }
 
-            return true;
-        }
-#endif // !defined(_M_ARM64EC)
+            template <bool _Equal_goes_right>
+            static _Ty* _Partition(_Ty* const _First, _Ty* const _Last, const _Ty _Pivot) noexcept {
+                // Requires at least two vectors. The first and the last vectors are read up front, which leaves room
+                // for a full vector store at both ends; each next vector is read from the side with less room left,
+                // so that after the read both sides have room for one. Values going left are permuted to the bottom
+                // of the vector and stored at the left end; values going right are permuted to the top and stored
+                // at the right end.
+                const __m256i _Pivot_vec = _Traits::_Set(_Pivot);
+                const auto& _Tables      = _Partition_table();
+
+                _Ty* _Left_out  = _First;
+                _Ty* _Right_out = _Last;
+
+                const auto _Partition_vec = [&](const __m256i _Val) noexcept {
+                    unsigned int _Right_mask;
+                    if constexpr (_Equal_goes_right) {
+                        _Right_mask = ~_Traits::_Gt_mask(_Pivot_vec, _Val) & ((1u << _Lanes) - 1);
+                    } else {
+                        _Right_mask = _Traits::_Gt_mask(_Val, _Pivot_vec);
+                    }
 
-        template <class _Elem>
-        bool _Fallback(void* const _Dest, const _Elem* const _Src, const size_t _Size_bytes, const size_t _Size_bits,
-            const size_t _Size_chars, const _Elem _Elem0, const _Elem _Elem1) noexcept {
-            const auto _Dest_bytes = static_cast<uint8_t*>(_Dest);
-            size_t _Size_convert   = _Size_chars;
+                    const __m256i _Shuf  = _mm256_cvtepu8_epi32(_mm_loadu_si64(_Tables._Shuf[_Right_mask]));
+                    const __m256i _Moved = _mm256_permutevar8x32_epi32(_Val, _Shuf);
+                    const size_t _Left_count = _Tables._Left_count[_Right_mask];
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Left_out), _Moved);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Right_out - _Lanes), _Moved);
+                    _Left_out += _Left_count;
+                    _Right_out -= _Lanes - _Left_count;
+                };
 
-            if (_Size_chars > _Size_bits) {
-                _Size_convert = _Size_bits;
+                const __m256i _First_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_First));
+                const __m256i _Last_vec  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Last - _Lanes));
 
-                for (size_t _Ix = _Size_bits; _Ix < _Size_chars; ++_Ix) {
-                    if (const _Elem _Cur = _Src[_Ix]; _Cur != _Elem0 && _Cur != _Elem1) [[unlikely]] {
-                        return false;
+                _Ty* _Left_in  = _First + _Lanes;
+                _Ty* _Right_in = _Last - _Lanes;
+
+                while (static_cast<size_t>(_Right_in - _Left_in) >= _Lanes) {
+                    __m256i _Val;
+                    if (_Left_in - _Left_out <= _Right_out - _Right_in) {
+                        _Val = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Left_in));
+                        _Left_in += _Lanes;
+                    } else {
+                        _Right_in -= _Lanes;
+                        _Val = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Right_in));
                     }
+
+                    _Partition_vec(_Val);
                 }
-            }
 
-            _CSTD memset(_Dest, 0, _Size_bytes);
+                // Fewer than a vector of unread values remain. Set them aside, so that everything between the
+                // outputs is free, then place them one at a time.
+                _Ty _Rest[_Lanes];
+                const size_t _Rest_count = static_cast<size_t>(_Right_in - _Left_in);
+                for (size_t _Ix = 0; _Ix != _Rest_count; ++_Ix) {
+                    _Rest[_Ix] = _Left_in[_Ix];
+                }
 
-            for (size_t _Ix = 0; _Ix != _Size_convert; ++_Ix) {
-                const _Elem _Cur = _Src[_Size_convert - _Ix - 1];
+                for (size_t _Ix = 0; _Ix != _Rest_count; ++_Ix) {
+                    const _Ty _Val = _Rest[_Ix];
+                    bool _Goes_right;
+                    if constexpr (_Equal_goes_right) {
+                        _Goes_right = !(_Val < _Pivot);
+                    } else {
+                        _Goes_right = _Pivot < _Val;
+                    }
 
-                if (_Cur != _Elem0 && _Cur != _Elem1) [[unlikely]] {
-                    return false;
+                    if (_Goes_right) {
+                        *--_Right_out = _Val;
+                    } else {
+                        *_Left_out++ = _Val;
+                    }
                 }
 
-                _Dest_bytes[_Ix >> 3] |= static_cast<uint8_t>(_Cur == _Elem1) << (_Ix & 0x7);
+                // Exactly two vectors of room remain, and the last of these stores overlaps itself completely.
+                _Partition_vec(_First_vec);
+                _Partition_vec(_Last_vec);
+                return _Left_out;
             }
+        };
+#endif // !defined(_M_ARM64EC)
 
-            return true;
-        }
+        template <class _Base, class _Avx_traits, class _Reverse_fn>
+        void _Sort_dispatch(void* const _First_ptr, void* const _Last_ptr, const bool _Descending,
+            _Reverse_fn _Reverse) noexcept {
+            using _Ty        = typename _Base::_Value_type;
+            _Ty* const _First = static_cast<_Ty*>(_First_ptr);
+            _Ty* _Last        = static_cast<_Ty*>(_Last_ptr);
 
-        template <class _Avx, class _Sse, class _Elem>
-        bool _Dispatch(void* _Dest, const _Elem* _Src, size_t _Size_bytes, size_t _Size_bits, size_t _Size_chars,
-            _Elem _Elem0, _Elem _Elem1) noexcept {
-#ifndef _M_ARM64EC
-            if (_Use_avx2() && _Size_bits >= 256) {
-                _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+            if constexpr (_Base::_Floating) {
+                // NaNs are unordered with everything, so they go to the end, in both ascending and descending order.
+                _Last = _Partition_scalar(_First, _Last, [](const _Ty _Val) { return _Val != _Val; });
+            }
 
-                return _Impl<_Avx>(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
-            } else if (_Use_sse42()) {
-                return _Impl<_Sse>(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+            const ptrdiff_t _Size = _Last - _First;
+            if (_Size < 2) {
+                return;
+            }
+
+#ifndef _M_ARM64EC
+            if (_Use_avx2()) {
+                _Introsort<_Sort_avx<_Avx_traits>>(_First, _Last, _Size);
+                _mm256_zeroupper(); // TRANSITION, DevCom-10331414
             } else
 #endif // !defined(_M_ARM64EC)
             {
-                return _Fallback(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+                _Introsort<_Sort_traits_scalar<_Base>>(_First, _Last, _Size);
             }
-        }
 
-    } // namespace __std_bitset_from_string
+            if (_Descending) {
+                // Equivalent elements have no order to keep, so sorting ascending and reversing is a valid sort.
+                _Reverse(_First, _Last);
+            }
+        }
 
+#ifdef _M_ARM64EC
+        using _Sort_traits_4i_avx = void;
+        using _Sort_traits_4u_avx = void;
+        using _Sort_traits_8i_avx = void;
+        using _Sort_traits_8u_avx = void;
+        using _Sort_traits_f_avx  = void;
+        using _Sort_traits_d_avx  = void;
+#endif // ^^^ defined(_M_ARM64EC) ^^^
+    } // namespace __std_sort
 } // unnamed namespace
 
 extern "C" {
 
-__declspec(noalias) bool __stdcall __std_bitset_from_string_1(void* _Dest, const char* _Src, size_t _Size_bytes,
-    size_t _Size_bits, size_t _Size_chars, char _Elem0, char _Elem1) noexcept {
-    using namespace __std_bitset_from_string;
+__declspec(noalias) void __stdcall __std_sort_4i(
+    void* const _First, void* const _Last, const bool _Descending) noexcept {
+    using namespace __std_sort;
+    _Sort_dispatch<_Sort_traits_4i_base, _Sort_traits_4i_avx>(
+        _First, _Last, _Descending, __std_reverse_trivially_swappable_4);
+}
 
-    return _Dispatch<_Traits_1_avx, _Traits_1_sse>(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+__declspec(noalias) void __stdcall __std_sort_4u(
+    void* const _First, void* const _Last, const bool _Descending) noexcept {
+    using namespace __std_sort;
+    _Sort_dispatch<_Sort_traits_4u_base, _Sort_traits_4u_avx>(
+        _First, _Last, _Descending, __std_reverse_trivially_swappable_4);
 }
 
-__declspec(noalias) bool __stdcall __std_bitset_from_string_2(void* _Dest, const wchar_t* _Src, size_t _Size_bytes,
-    size_t _Size_bits, size_t _Size_chars, wchar_t _Elem0, wchar_t _Elem1) noexcept {
-    using namespace __std_bitset_from_string;
+__declspec(noalias) void __stdcall __std_sort_8i(
+    void* const _First, void* const _Last, const bool _Descending) noexcept {
+    using namespace __std_sort;
+    _Sort_dispatch<_Sort_traits_8i_base, _Sort_traits_8i_avx>(
+        _First, _Last, _Descending, __std_reverse_trivially_swappable_8);
+}
 
-    return _Dispatch<_Traits_2_avx, _Traits_2_sse>(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+__declspec(noalias) void __stdcall __std_sort_8u(
+    void* const _First, void* const _Last, const bool _Descending) noexcept {
+    using namespace __std_sort;
+    _Sort_dispatch<_Sort_traits_8u_base, _Sort_traits_8u_avx>(
+        _First, _Last, _Descending, __std_reverse_trivially_swappable_8);
+}
+
+__declspec(noalias) void __stdcall __std_sort_f(
+    void* const _First, void* const _Last, const bool _Descending) noexcept {
+    using namespace __std_sort;
+    _Sort_dispatch<_Sort_traits_f_base, _Sort_traits_f_avx>(
+        _First, _Last, _Descending, __std_reverse_trivially_swappable_4);
+}
+
+__declspec(noalias) void __stdcall __std_sort_d(
+    void* const _First, void* const _Last, const bool _Descending) noexcept {
+    using namespace __std_sort;
+    _Sort_dispatch<_Sort_traits_d_base, _Sort_traits_d_avx>(
+        _First, _Last, _Descending, __std_reverse_trivially_swappable_8);
+}
+
+} // extern "C"
+
+namespace {
+    namespace __std_adjacent_find {
+        // adjacent_find, is_sorted_until, and unique all look for the first element that relates to its successor in
+        // some way. The vectorized loop loads the same range twice, the second time one element further, so that every
+        // lane holds an adjacent pair.
+        enum _Pair_pred {
+            _Pred_equal, // *_Cur == *_Next, for adjacent_find and unique
+            _Pred_less, // *_Next < *_Cur, where is_sorted_until(less) stops
+            _Pred_greater, // *_Next > *_Cur, where is_sorted_until(greater) stops
+        };
+
+        template <_Pair_pred _Pred, class _Ty>
+        const void* _Find_pair_fallback(const void* const _First, const void* const _Last) noexcept {
+            auto _Cur        = static_cast<const _Ty*>(_First);
+            const auto _Stop = static_cast<const _Ty*>(_Last) - 1;
+            for (; _Cur != _Stop; ++_Cur) {
+                if constexpr (_Pred == _Pred_equal) {
+                    if (_Cur[0] == _Cur[1]) {
+                        return _Cur;
+                    }
+                } else if constexpr (_Pred == _Pred_less) {
+                    if (_Cur[1] < _Cur[0]) {
+                        return _Cur;
+                    }
+                } else {
+                    if (_Cur[1] > _Cur[0]) {
+                        return _Cur;
+                    }
+                }
+            }
+
+            return _Last;
+        }
+
+#ifndef _M_ARM64EC
+        template <class _Traits, _Pair_pred _Pred, class _Vec>
+        auto _Pair_matches(const _Vec _Cur, const _Vec _Next, const bool _Sign) noexcept {
+            if constexpr (_Pred == _Pred_equal) {
+                return _Traits::_Cmp_eq(_Cur, _Next);
+            } else if constexpr (_Pred == _Pred_less) {
+                return _Traits::_Cmp_gt(
+                    _Traits::_Sign_correction(_Cur, _Sign), _Traits::_Sign_correction(_Next, _Sign));
+            } else {
+                return _Traits::_Cmp_gt(
+                    _Traits::_Sign_correction(_Next, _Sign), _Traits::_Sign_correction(_Cur, _Sign));
+            }
+        }
+
+        template <class _Traits, _Pair_pred _Pred>
+        const void* _Find_pair_vectorized(const void* _First, const void* const _Last, const bool _Sign) noexcept {
+            // The range must hold at least _Vec_size bytes plus one element.
+            constexpr size_t _Elem_size = sizeof(typename _Traits::_Signed_t);
+
+            // The last step is moved back to end exactly at _Last instead of leaving a scalar tail.
+            // The pairs it compares again are already known not to match.
+            const void* _Stop = _Last;
+            _Rewind_bytes(_Stop, _Traits::_Vec_size + _Elem_size);
+
+            for (;;) {
+                const void* _Next = _First;
+                _Advance_bytes(_Next, _Elem_size);
+
+                const auto _Match =
+                    _Pair_matches<_Traits, _Pred>(_Traits::_Load(_First), _Traits::_Load(_Next), _Sign);
+                const unsigned long _Bingo = _Traits::_Mask(_Traits::_Mask_cast(_Match));
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, _Bingo);
+                    _Advance_bytes(_First, _Offset);
+                    _Traits::_Exit_vectorized();
+                    return _First;
+                }
+
+                if (_First == _Stop) {
+                    break;
+                }
+
+                if (_Byte_length(_First, _Stop) > _Traits::_Vec_size) {
+                    _Advance_bytes(_First, _Traits::_Vec_size);
+                } else {
+                    _First = _Stop;
+                }
+            }
+
+            _Traits::_Exit_vectorized();
+            return _Last;
+        }
+#endif // !defined(_M_ARM64EC)
+
+        template <class _Traits, _Pair_pred _Pred>
+        const void* _Find_pair(const void* const _First, const void* const _Last, const bool _Sign) noexcept {
+            // Returns the first element of the first matching pair, or _Last.
+            using _Base                 = typename _Traits::_Scalar;
+            constexpr size_t _Elem_size = sizeof(typename _Base::_Signed_t);
+
+            const size_t _Size_bytes = _Byte_length(_First, _Last);
+            if (_Size_bytes < 2 * _Elem_size) {
+                return _Last;
+            }
+
+#ifndef _M_ARM64EC
+            if (_Use_avx2() && _Size_bytes >= 32 + _Elem_size) {
+                return _Find_pair_vectorized<typename _Traits::_Avx, _Pred>(_First, _Last, _Sign);
+            } else if (_Use_sse42() && _Size_bytes >= 16 + _Elem_size) {
+                return _Find_pair_vectorized<typename _Traits::_Sse, _Pred>(_First, _Last, _Sign);
+            }
+#endif // !defined(_M_ARM64EC)
+
+            if constexpr (_Base::_Is_floating) {
+                return _Find_pair_fallback<_Pred, typename _Base::_Signed_t>(_First, _Last);
+            } else if (_Sign) {
+                return _Find_pair_fallback<_Pred, typename _Base::_Signed_t>(_First, _Last);
+            } else {
+                return _Find_pair_fallback<_Pred, typename _Base::_Unsigned_t>(_First, _Last);
+            }
+        }
+
+        template <class _Traits>
+        const void* _Is_sorted_until_impl(
+            const void* const _First, const void* const _Last, const bool _Sign, const bool _Greater) noexcept {
+            const void* _Found = _Greater ? _Find_pair<_Traits, _Pred_greater>(_First, _Last, _Sign)
+                                          : _Find_pair<_Traits, _Pred_less>(_First, _Last, _Sign);
+            if (_Found != _Last) {
+                // The pair's second element is the one out of order.
+                _Advance_bytes(_Found, sizeof(typename _Traits::_Scalar::_Signed_t));
+            }
+
+            return _Found;
+        }
+
+        template <class _Ty>
+        void* _Unique_fallback(void* const _First, void* const _Last, void* const _Out) noexcept {
+            // Keeps each element that differs from its predecessor; _First[-1] must still hold its original value.
+            // Writes stay behind the read position, so the predecessor of the current element is never overwritten.
+            _Ty* _Src  = reinterpret_cast<_Ty*>(_First);
+            _Ty* _Dest = reinterpret_cast<_Ty*>(_Out);
+
+            while (_Src != _Last) {
+                if (_Src[0] != _Src[-1]) {
+                    *_Dest = *_Src;
+                    ++_Dest;
+                }
+
+                ++_Src;
+            }
+
+            return _Dest;
+        }
+
+        template <class _Traits>
+        bool _Unique_start(void*& _First, void* const _Last, void*& _Out) noexcept {
+            // Finds the first duplicate; everything before it stays in place. On success, _Out is where the next kept
+            // element goes, and _First is the first element to examine, whose predecessor is the removed duplicate.
+            const void* const _Found = _Find_pair<_Traits, _Pred_equal>(_First, _Last, false);
+            if (_Found == _Last) {
+                return false;
+            }
+
+            constexpr size_t _Elem_size = sizeof(typename _Traits::_Scalar::_Signed_t);
+
+            _Out = const_cast<void*>(_Found);
+            _Advance_bytes(_Out, _Elem_size);
+            _First = _Out;
+            _Advance_bytes(_First, _Elem_size);
+            return true;
+        }
+    } // namespace __std_adjacent_find
+} // unnamed namespace
+
+extern "C" {
+
+const void* __stdcall __std_adjacent_find_1(const void* const _First, const void* const _Last) noexcept {
+    return __std_adjacent_find::_Find_pair<_Minmax_traits_1, __std_adjacent_find::_Pred_equal>(_First, _Last, false);
+}
+
+const void* __stdcall __std_adjacent_find_2(const void* const _First, const void* const _Last) noexcept {
+    return __std_adjacent_find::_Find_pair<_Minmax_traits_2, __std_adjacent_find::_Pred_equal>(_First, _Last, false);
+}
+
+const void* __stdcall __std_adjacent_find_4(const void* const _First, const void* const _Last) noexcept {
+    return __std_adjacent_find::_Find_pair<_Minmax_traits_4, __std_adjacent_find::_Pred_equal>(_First, _Last, false);
+}
+
+const void* __stdcall __std_adjacent_find_8(const void* const _First, const void* const _Last) noexcept {
+    return __std_adjacent_find::_Find_pair<_Minmax_traits_8, __std_adjacent_find::_Pred_equal>(_First, _Last, false);
+}
+
+const void* __stdcall __std_is_sorted_until_1(
+    const void* const _First, const void* const _Last, const bool _Signed, const bool _Greater) noexcept {
+    return __std_adjacent_find::_Is_sorted_until_impl<_Minmax_traits_1>(_First, _Last, _Signed, _Greater);
+}
+
+const void* __stdcall __std_is_sorted_until_2(
+    const void* const _First, const void* const _Last, const bool _Signed, const bool _Greater) noexcept {
+    return __std_adjacent_find::_Is_sorted_until_impl<_Minmax_traits_2>(_First, _Last, _Signed, _Greater);
+}
+
+const void* __stdcall __std_is_sorted_until_4(
+    const void* const _First, const void* const _Last, const bool _Signed, const bool _Greater) noexcept {
+    return __std_adjacent_find::_Is_sorted_until_impl<_Minmax_traits_4>(_First, _Last, _Signed, _Greater);
+}
+
+const void* __stdcall __std_is_sorted_until_8(
+    const void* const _First, const void* const _Last, const bool _Signed, const bool _Greater) noexcept {
+    return __std_adjacent_find::_Is_sorted_until_impl<_Minmax_traits_8>(_First, _Last, _Signed, _Greater);
+}
+
+const void* __stdcall __std_is_sorted_until_f(
+    const void* const _First, const void* const _Last, bool, const bool _Greater) noexcept {
+    return __std_adjacent_find::_Is_sorted_until_impl<_Minmax_traits_f>(_First, _Last, true, _Greater);
+}
+
+const void* __stdcall __std_is_sorted_until_d(
+    const void* const _First, const void* const _Last, bool, const bool _Greater) noexcept {
+    return __std_adjacent_find::_Is_sorted_until_impl<_Minmax_traits_d>(_First, _Last, true, _Greater);
+}
+
+void* __stdcall __std_unique_1(void* _First, void* const _Last) noexcept {
+    void* _Out;
+    if (!__std_adjacent_find::_Unique_start<_Minmax_traits_1>(_First, _Last, _Out)) {
+        return _Last;
+    }
+
+#ifndef _M_ARM64EC
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_sse42() && _Size_bytes >= 8) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{7});
+        do {
+            void* _Prev = _First;
+            _Rewind_bytes(_Prev, 1);
+            const __m128i _Src    = _mm_loadu_si64(_First);
+            const __m128i _Before = _mm_loadu_si64(_Prev);
+            const uint32_t _Bingo = _mm_movemask_epi8(_mm_cmpeq_epi8(_Src, _Before)) & 0xFF;
+            const __m128i _Shuf   = _mm_loadu_si64(_Remove_tables_1_sse._Shuf[_Bingo]);
+            const __m128i _Dest   = _mm_shuffle_epi8(_Src, _Shuf);
+            _mm_storeu_si64(_Out, _Dest);
+            _Advance_bytes(_Out, _Remove_tables_1_sse._Size[_Bingo]);
+            _Advance_bytes(_First, 8);
+        } while (_First != _Stop);
+    }
+#endif // !defined(_M_ARM64EC)
+
+    return __std_adjacent_find::_Unique_fallback<uint8_t>(_First, _Last, _Out);
+}
+
+void* __stdcall __std_unique_2(void* _First, void* const _Last) noexcept {
+    void* _Out;
+    if (!__std_adjacent_find::_Unique_start<_Minmax_traits_2>(_First, _Last, _Out)) {
+        return _Last;
+    }
+
+#ifndef _M_ARM64EC
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_sse42() && _Size_bytes >= 16) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
+        do {
+            void* _Prev = _First;
+            _Rewind_bytes(_Prev, 2);
+            const __m128i _Src    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_First));
+            const __m128i _Before = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Prev));
+            const __m128i _Mask   = _mm_cmpeq_epi16(_Src, _Before);
+            const uint32_t _Bingo = _mm_movemask_epi8(_mm_packs_epi16(_Mask, _mm_setzero_si128()));
+            const __m128i _Shuf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Remove_tables_2_sse._Shuf[_Bingo]));
+            const __m128i _Dest = _mm_shuffle_epi8(_Src, _Shuf);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(_Out), _Dest);
+            _Advance_bytes(_Out, _Remove_tables_2_sse._Size[_Bingo]);
+            _Advance_bytes(_First, 16);
+        } while (_First != _Stop);
+    }
+#endif // !defined(_M_ARM64EC)
+
+    return __std_adjacent_find::_Unique_fallback<uint16_t>(_First, _Last, _Out);
+}
+
+void* __stdcall __std_unique_4(void* _First, void* const _Last) noexcept {
+    void* _Out;
+    if (!__std_adjacent_find::_Unique_start<_Minmax_traits_4>(_First, _Last, _Out)) {
+        return _Last;
+    }
+
+#ifndef _M_ARM64EC
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
+        do {
+            void* _Prev = _First;
+            _Rewind_bytes(_Prev, 4);
+            const __m256i _Src    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_First));
+            const __m256i _Before = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Prev));
+            const __m256i _Mask   = _mm256_cmpeq_epi32(_Src, _Before);
+            const uint32_t _Bingo = _mm256_movemask_ps(_mm256_castsi256_ps(_Mask));
+            const __m256i _Shuf   = _mm256_cvtepu8_epi32(_mm_loadu_si64(_Remove_tables_4_avx._Shuf[_Bingo]));
+            const __m256i _Dest   = _mm256_permutevar8x32_epi32(_Src, _Shuf);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Out), _Dest);
+            _Advance_bytes(_Out, _Remove_tables_4_avx._Size[_Bingo]);
+            _Advance_bytes(_First, 32);
+        } while (_First != _Stop);
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+    } else if (_Use_sse42() && _Size_bytes >= 16) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
+        do {
+            void* _Prev = _First;
+            _Rewind_bytes(_Prev, 4);
+            const __m128i _Src    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_First));
+            const __m128i _Before = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Prev));
+            const __m128i _Mask   = _mm_cmpeq_epi32(_Src, _Before);
+            const uint32_t _Bingo = _mm_movemask_ps(_mm_castsi128_ps(_Mask));
+            const __m128i _Shuf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Remove_tables_4_sse._Shuf[_Bingo]));
+            const __m128i _Dest = _mm_shuffle_epi8(_Src, _Shuf);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(_Out), _Dest);
+            _Advance_bytes(_Out, _Remove_tables_4_sse._Size[_Bingo]);
+            _Advance_bytes(_First, 16);
+        } while (_First != _Stop);
+    }
+#endif // !defined(_M_ARM64EC)
+
+    return __std_adjacent_find::_Unique_fallback<uint32_t>(_First, _Last, _Out);
+}
+
+void* __stdcall __std_unique_8(void* _First, void* const _Last) noexcept {
+    void* _Out;
+    if (!__std_adjacent_find::_Unique_start<_Minmax_traits_8>(_First, _Last, _Out)) {
+        return _Last;
+    }
+
+#ifndef _M_ARM64EC
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
+        do {
+            void* _Prev = _First;
+            _Rewind_bytes(_Prev, 8);
+            const __m256i _Src    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_First));
+            const __m256i _Before = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Prev));
+            const __m256i _Mask   = _mm256_cmpeq_epi64(_Src, _Before);
+            const uint32_t _Bingo = _mm256_movemask_pd(_mm256_castsi256_pd(_Mask));
+            const __m256i _Shuf   = _mm256_cvtepu8_epi32(_mm_loadu_si64(_Remove_tables_8_avx._Shuf[_Bingo]));
+            const __m256i _Dest   = _mm256_permutevar8x32_epi32(_Src, _Shuf);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Out), _Dest);
+            _Advance_bytes(_Out, _Remove_tables_8_avx._Size[_Bingo]);
+            _Advance_bytes(_First, 32);
+        } while (_First != _Stop);
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+    } else if (_Use_sse42() && _Size_bytes >= 16) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
+        do {
+            void* _Prev = _First;
+            _Rewind_bytes(_Prev, 8);
+            const __m128i _Src    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_First));
+            const __m128i _Before = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Prev));
+            const __m128i _Mask   = _mm_cmpeq_epi64(_Src, _Before);
+            const uint32_t _Bingo = _mm_movemask_pd(_mm_castsi128_pd(_Mask));
+            const __m128i _Shuf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Remove_tables_8_sse._Shuf[_Bingo]));
+            const __m128i _Dest = _mm_shuffle_epi8(_Src, _Shuf);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(_Out), _Dest);
+            _Advance_bytes(_Out, _Remove_tables_8_sse._Size[_Bingo]);
+            _Advance_bytes(_First, 16);
+        } while (_First != _Stop);
+    }
+#endif // !defined(_M_ARM64EC)
+
+    return __std_adjacent_find::_Unique_fallback<uint64_t>(_First, _Last, _Out);
+}
+
+} // extern "C"
+
+namespace {
+    namespace __std_bitset_to_string {
+#ifdef _M_ARM64EC
+        using _Traits_1_avx = void;
+        using _Traits_1_sse = void;
+        using _Traits_2_avx = void;
+        using _Traits_2_sse = void;
+#else // ^^^ defined(_M_ARM64EC) / !defined(_M_ARM64EC) vvv
+        struct _Traits_1_avx {
+            using _Value_type = uint32_t;
+
+            static __m256i _Set(const char _Val) noexcept {
+                return _mm256_broadcastb_epi8(_mm_cvtsi32_si128(_Val));
+            }
+
+            static __m256i __forceinline _Step(const uint32_t _Val, const __m256i _Px0, const __m256i _Px1) noexcept {
+                const __m128i _Vx0 = _mm_cvtsi32_si128(_Val);
+                const __m128i _Vx1 =
+                    _mm_shuffle_epi8(_Vx0, _mm_set_epi32(0x00000000, 0x01010101, 0x02020202, 0x03030303));
+                const __m256i _Vx2 = _mm256_castsi128_si256(_Vx1);
+                const __m256i _Vx3 = _mm256_permutevar8x32_epi32(_Vx2, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+                const __m256i _Msk = _mm256_and_si256(_Vx3, _mm256_set1_epi64x(0x0102040810204080));
+                const __m256i _Ex0 = _mm256_cmpeq_epi8(_Msk, _mm256_setzero_si256());
+                const __m256i _Ex1 = _mm256_blendv_epi8(_Px1, _Px0, _Ex0);
+                return _Ex1;
+            }
+
+            static void _Out(void* _Dest, const __m256i _Elems) noexcept {
+                _mm256_storeu_si256(static_cast<__m256i*>(_Dest), _Elems);
+            }
+        };
+
+        struct _Traits_1_sse {
+            using _Value_type = uint16_t;
+
+            static __m128i _Set(const char _Val) noexcept {
+                return _mm_shuffle_epi8(_mm_cvtsi32_si128(_Val), _mm_setzero_si128());
+            }
+
+            static __m128i __forceinline _Step(const uint16_t _Val, const __m128i _Px0, const __m128i _Px1) noexcept {
+                const __m128i _Vx0 = _mm_cvtsi32_si128(_Val);
+                const __m128i _Vx1 =
+                    _mm_shuffle_epi8(_Vx0, _mm_set_epi32(0x00000000, 0x00000000, 0x01010101, 0x01010101));
+                const __m128i _Msk = _mm_and_si128(_Vx1, _mm_set1_epi64x(0x0102040810204080));
+                const __m128i _Ex0 = _mm_cmpeq_epi8(_Msk, _mm_setzero_si128());
+                const __m128i _Ex1 = _mm_blendv_epi8(_Px1, _Px0, _Ex0);
+                return _Ex1;
+            }
+
+            static void _Out(void* _Dest, const __m128i _Elems) noexcept {
+                _mm_storeu_si128(static_cast<__m128i*>(_Dest), _Elems);
+            }
+        };
+
+        struct _Traits_2_avx {
+            using _Value_type = uint16_t;
+
+            static __m256i _Set(const wchar_t _Val) noexcept {
+                return _mm256_broadcastw_epi16(_mm_cvtsi32_si128(_Val));
+            }
+
+            static __m256i __forceinline _Step(const uint16_t _Val, const __m256i _Px0, const __m256i _Px1) noexcept {
+                const __m128i _Vx0 = _mm_cvtsi32_si128(_Val);
+                const __m128i _Vx1 =
+                    _mm_shuffle_epi8(_Vx0, _mm_set_epi32(0x00000000, 0x00000000, 0x01010101, 0x01010101));
+                const __m256i _Vx2 = _mm256_castsi128_si256(_Vx1);
+                const __m256i _Vx3 = _mm256_permute4x64_epi64(_Vx2, _MM_SHUFFLE(1, 1, 0, 0));
+                const __m256i _Msk = _mm256_and_si256(_Vx3,
+                    _mm256_set_epi64x(0x0001000200040008, 0x0010002000400080, 0x0001000200040008, 0x0010002000400080));
+                const __m256i _Ex0 = _mm256_cmpeq_epi16(_Msk, _mm256_setzero_si256());
+                const __m256i _Ex1 = _mm256_blendv_epi8(_Px1, _Px0, _Ex0);
+                return _Ex1;
+            }
+
+            static void _Out(void* _Dest, const __m256i _Elems) noexcept {
+                _mm256_storeu_si256(static_cast<__m256i*>(_Dest), _Elems);
+            }
+        };
+
+        struct _Traits_2_sse {
+            using _Value_type = uint8_t;
+
+            static __m128i _Set(const wchar_t _Val) noexcept {
+                return _mm_set1_epi16(_Val);
+            }
+
+            static __m128i __forceinline _Step(const uint8_t _Val, const __m128i _Px0, const __m128i _Px1) noexcept {
+                const __m128i _Vx  = _mm_set1_epi16(_Val);
+                const __m128i _Msk = _mm_and_si128(_Vx, _mm_set_epi64x(0x0001000200040008, 0x0010002000400080));
+                const __m128i _Ex0 = _mm_cmpeq_epi16(_Msk, _mm_setzero_si128());
+                const __m128i _Ex1 = _mm_blendv_epi8(_Px1, _Px0, _Ex0);
+                return _Ex1;
+            }
+
+            static void _Out(void* _Dest, const __m128i _Elems) noexcept {
+                _mm_storeu_si128(static_cast<__m128i*>(_Dest), _Elems);
+            }
+        };
+
+        template <class _Traits, class _Elem>
+        void __stdcall _Impl(
+            _Elem* const _Dest, const void* _Src, size_t _Size_bits, const _Elem _Elem0, const _Elem _Elem1) noexcept {
+            constexpr size_t _Step_size_bits = sizeof(_Traits::_Value_type) * 8;
+
+            const auto _Px0 = _Traits::_Set(_Elem0);
+            const auto _Px1 = _Traits::_Set(_Elem1);
+            if (_Size_bits >= _Step_size_bits) {
+                _Elem* _Pos = _Dest + _Size_bits;
+                _Size_bits &= _Step_size_bits - 1;
+                _Elem* const _Stop_at = _Dest + _Size_bits;
+                do {
+                    typename _Traits::_Value_type _Val;
+                    memcpy(&_Val, _Src, sizeof(_Val));
+                    const auto _Elems = _Traits::_Step(_Val, _Px0, _Px1);
+                    _Pos -= _Step_size_bits;
+                    _Traits::_Out(_Pos, _Elems);
+                    _Advance_bytes(_Src, sizeof(_Val));
+                } while (_Pos != _Stop_at);
+            }
+
+            if (_Size_bits > 0) {
+                __assume(_Size_bits < sizeof(_Traits::_Value_type));
+                typename _Traits::_Value_type _Val;
+                memcpy(&_Val, _Src, sizeof(_Val));
+                const auto _Elems = _Traits::_Step(_Val, _Px0, _Px1);
+                _Elem _Tmp[_Step_size_bits];
+                _Traits::_Out(_Tmp, _Elems);
+                const _Elem* const _Tmpd = _Tmp + (_Step_size_bits - _Size_bits);
+                memcpy(_Dest, _Tmpd, _Size_bits * sizeof(_Elem));
+            }
+        }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+        template <class _Avx_traits, class _Sse_traits, class _Elem>
+        void __stdcall _Dispatch(_Elem* const _Dest, const void* const _Src, const size_t _Size_bits,
+            const _Elem _Elem0, const _Elem _Elem1) noexcept {
+#ifndef _M_ARM64EC
+            if (_Use_avx2() && _Size_bits >= 256) {
+                _Impl<_Avx_traits>(_Dest, _Src, _Size_bits, _Elem0, _Elem1);
+                _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+            } else if (_Use_sse42()) {
+                _Impl<_Sse_traits>(_Dest, _Src, _Size_bits, _Elem0, _Elem1);
+            } else
+#endif // !defined(_M_ARM64EC)
+            {
+                const auto _Arr = reinterpret_cast<const uint8_t*>(_Src);
+                for (size_t _Ix = 0; _Ix < _Size_bits; ++_Ix) {
+                    _Dest[_Size_bits - 1 - _Ix] = ((_Arr[_Ix >> 3] >> (_Ix & 7)) & 1) != 0 ? _Elem1 : _Elem0;
+                }
+            }
+        }
+    } // namespace __std_bitset_to_string
+} // unnamed namespace
+
+extern "C" {
+
+__declspec(noalias) void __stdcall __std_bitset_to_string_1(
+    char* const _Dest, const void* const _Src, const size_t _Size_bits, const char _Elem0, const char _Elem1) noexcept {
+    using namespace __std_bitset_to_string;
+    _Dispatch<_Traits_1_avx, _Traits_1_sse>(_Dest, _Src, _Size_bits, _Elem0, _Elem1);
+}
+
+__declspec(noalias) void __stdcall __std_bitset_to_string_2(wchar_t* const _Dest, const void* const _Src,
+    const size_t _Size_bits, const wchar_t _Elem0, const wchar_t _Elem1) noexcept {
+    using namespace __std_bitset_to_string;
+    _Dispatch<_Traits_2_avx, _Traits_2_sse>(_Dest, _Src, _Size_bits, _Elem0, _Elem1);
+}
+
+} // extern "C"
+
+namespace {
+
+    namespace __std_bitset_from_string {
+
+#ifdef _M_ARM64EC
+        using _Traits_1_avx = void;
+        using _Traits_1_sse = void;
+        using _Traits_2_avx = void;
+        using _Traits_2_sse = void;
+#else // ^^^ defined(_M_ARM64EC) / !defined(_M_ARM64EC) vvv
+        struct _Traits_avx {
+            using _Vec = __m256i;
+
+            static __m256i _Load(const void* _Src) noexcept {
+                return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src));
+            }
+
+            static void _Store(void* _Dest, const __m256i _Val) noexcept {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest), _Val);
+            }
+
+            static bool _Check(const __m256i _Val, const __m256i _Ex1, const __m256i _Dx0) noexcept {
+                return _mm256_testc_si256(_Ex1, _mm256_xor_si256(_Val, _Dx0));
+            }
+        };
+
+        struct _Traits_sse {
+            using _Vec = __m128i;
+
+            static __m128i _Load(const void* _Src) noexcept {
+                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src));
+            }
+
+            static void _Store(void* _Dest, const __m128i _Val) noexcept {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest), _Val);
+            }
+
+            static bool _Check(const __m128i _Val, const __m128i _Ex1, const __m128i _Dx0) noexcept {
+                return _mm_testc_si128(_Ex1, _mm_xor_si128(_Val, _Dx0));
+            }
+        };
+
+        struct _Traits_1_avx : _Traits_avx {
+            using _Word = uint32_t;
+
+            static __m256i _Set(const char _Val) noexcept {
+                return _mm256_set1_epi8(_Val);
+            }
+
+            static uint32_t _To_bits(const __m256i _Ex1) noexcept {
+                const __m256i _Shuf = _mm256_set_epi8( //
+                    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, //
+                    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+                const __m256i _Ex2 = _mm256_shuffle_epi8(_Ex1, _Shuf);
+                return _rotl(static_cast<uint32_t>(_mm256_movemask_epi8(_Ex2)), 16);
+            }
+
+            static __m256i _Cmp(const __m256i _Val, const __m256i _Dx1) noexcept {
+                return _mm256_cmpeq_epi8(_Val, _Dx1);
+            }
+        };
+
+        struct _Traits_1_sse : _Traits_sse {
+            using _Word = uint16_t;
+
+            static __m128i _Set(const char _Val) noexcept {
+                return _mm_shuffle_epi8(_mm_cvtsi32_si128(_Val), _mm_setzero_si128());
+            }
+
+            static uint16_t _To_bits(const __m128i _Ex1) noexcept {
+                const __m128i _Shuf = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+                const __m128i _Ex2  = _mm_shuffle_epi8(_Ex1, _Shuf);
+                return static_cast<uint16_t>(_mm_movemask_epi8(_Ex2));
+            }
+
+            static __m128i _Cmp(const __m128i _Val, const __m128i _Dx1) noexcept {
+                return _mm_cmpeq_epi8(_Val, _Dx1);
+            }
+        };
+
+        struct _Traits_2_avx : _Traits_avx {
+            using _Word = uint16_t;
+
+            static __m256i _Set(const wchar_t _Val) noexcept {
+                return _mm256_set1_epi16(_Val);
+            }
+
+            static uint16_t _To_bits(const __m256i _Ex1) noexcept {
+                const __m256i _Shuf = _mm256_set_epi8( //
+                    +0, +2, +4, +6, +8, 10, 12, 14, -1, -1, -1, -1, -1, -1, -1, -1, //
+                    -1, -1, -1, -1, -1, -1, -1, -1, +0, +2, +4, +6, +8, 10, 12, 14);
+
+                const __m256i _Ex2 = _mm256_shuffle_epi8(_Ex1, _Shuf);
+                return static_cast<uint16_t>(_rotl(static_cast<uint32_t>(_mm256_movemask_epi8(_Ex2)), 8));
+            }
+
+            static __m256i _Cmp(const __m256i _Val, const __m256i _Dx1) noexcept {
+                return _mm256_cmpeq_epi16(_Val, _Dx1);
+            }
+        };
+
+        struct _Traits_2_sse : _Traits_sse {
+            using _Word = uint8_t;
+
+            static __m128i _Set(const wchar_t _Val) noexcept {
+                return _mm_set1_epi16(_Val);
+            }
+
+            static uint8_t _To_bits(const __m128i _Ex1) noexcept {
+                const __m128i _Shuf = _mm_set_epi8(-1, -1, -1, -1, -1, -1, -1, -1, 0, 2, 4, 6, 8, 10, 12, 14);
+                const __m128i _Ex2  = _mm_shuffle_epi8(_Ex1, _Shuf);
+                return static_cast<uint8_t>(_mm_movemask_epi8(_Ex2));
+            }
+
+            static __m128i _Cmp(const __m128i _Val, const __m128i _Dx1) noexcept {
+                return _mm_cmpeq_epi16(_Val, _Dx1);
+            }
+        };
+
+        template <class _Traits, class _Elem, class _OutFn>
+        bool _Loop(const _Elem* const _Src, const _Elem* _Src_end, const typename _Traits::_Vec _Dx0,
+            const typename _Traits::_Vec _Dx1, _OutFn _Out) noexcept {
+            for (;;) {
+                typename _Traits::_Vec _Val;
+                constexpr size_t _Per_vec = sizeof(_Val) / sizeof(_Elem);
+
+                if (const size_t _Left = _Src_end - _Src; _Left >= _Per_vec) {
+                    _Src_end -= _Per_vec;
+                    _Val = _Traits::_Load(_Src_end);
+                } else if (_Left == 0) {
+                    return true;
+                } else {
+                    _Src_end = _Src;
+                    _Elem _Tmp[_Per_vec];
+                    _Traits::_Store(_Tmp, _Dx0);
+                    _Elem* const _Tmpd = _Tmp + (_Per_vec - _Left);
+                    _CSTD memcpy(_Tmpd, _Src_end, _Left * sizeof(_Elem));
+                    _Val = _Traits::_Load(_Tmp);
+                }
+
+                const auto _Ex1 = _Traits::_Cmp(_Val, _Dx1);
+
+                if (!_Traits::_Check(_Val, _Ex1, _Dx0)) {
+                    return false;
+                }
+
+                _Out(_Ex1);
+            }
+        }
+
+        template <class _Traits, class _Elem>
+        bool _Impl(void* const _Dest, const _Elem* const _Src, const size_t _Size_bytes, const size_t _Size_bits,
+            const size_t _Size_chars, const _Elem _Elem0, const _Elem _Elem1) noexcept {
+            const auto _Dx0 = _Traits::_Set(_Elem0);
+            const auto _Dx1 = _Traits::_Set(_Elem1);
+
+            auto _Dst_words      = reinterpret_cast<_Traits::_Word*>(_Dest);
+            void* _Dst_words_end = _Dst_words;
+            _Advance_bytes(_Dst_words_end, _Size_bytes);
+
+            auto _Out = [&_Dst_words](const _Traits::_Vec _Ex1) {
+                *_Dst_words = _Traits::_To_bits(_Ex1);
+                ++_Dst_words;
+            };
+
+            const size_t _Size_convert = (_Size_chars <= _Size_bits) ? _Size_chars : _Size_bits;
+
+            // Convert characters to bits
+            if (!_Loop<_Traits>(_Src, _Src + _Size_convert, _Dx0, _Dx1, _Out)) {
+                return false;
+            }
+
+            // Verify remaining characters, if any
+            if (_Size_convert != _Size_chars
+                && !_Loop<_Traits>(_Src + _Size_convert, _Src + _Size_chars, _Dx0, _Dx1, [](_Traits::_Vec) {})) {
+                return false;
+            }
+
+            // Trim tail (may be padding tail, or too short string, or both)
+            if (_Dst_words != _Dst_words_end) {
+                _CSTD memset(_Dst_words, 0, _Byte_length(_Dst_words, _Dst_words_end));
+            }
+
+            return true;
+        }
+#endif // !defined(_M_ARM64EC)
+
+        template <class _Elem>
+        bool _Fallback(void* const _Dest, const _Elem* const _Src, const size_t _Size_bytes, const size_t _Size_bits,
+            const size_t _Size_chars, const _Elem _Elem0, const _Elem _Elem1) noexcept {
+            const auto _Dest_bytes = static_cast<uint8_t*>(_Dest);
+            size_t _Size_convert   = _Size_chars;
+
+            if (_Size_chars > _Size_bits) {
+                _Size_convert = _Size_bits;
+
+                for (size_t _Ix = _Size_bits; _Ix < _Size_chars; ++_Ix) {
+                    if (const _Elem _Cur = _Src[_Ix]; _Cur != _Elem0 && _Cur != _Elem1) [[unlikely]] {
+                        return false;
+                    }
+                }
+            }
+
+            _CSTD memset(_Dest, 0, _Size_bytes);
+
+            for (size_t _Ix = 0; _Ix != _Size_convert; ++_Ix) {
+                const _Elem _Cur = _Src[_Size_convert - _Ix - 1];
+
+                if (_Cur != _Elem0 && _Cur != _Elem1) [[unlikely]] {
+                    return false;
+                }
+
+                _Dest_bytes[_Ix >> 3] |= static_cast<uint8_t>(_Cur == _Elem1) << (_Ix & 0x7);
+            }
+
+            return true;
+        }
+
+        template <class _Avx, class _Sse, class _Elem>
+        bool _Dispatch(void* _Dest, const _Elem* _Src, size_t _Size_bytes, size_t _Size_bits, size_t _Size_chars,
+            _Elem _Elem0, _Elem _Elem1) noexcept {
+#ifndef _M_ARM64EC
+            if (_Use_avx2() && _Size_bits >= 256) {
+                _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+                return _Impl<_Avx>(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+            } else if (_Use_sse42()) {
+                return _Impl<_Sse>(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+            } else
+#endif // !defined(_M_ARM64EC)
+            {
+                return _Fallback(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+            }
+        }
+
+    } // namespace __std_bitset_from_string
+
+} // unnamed namespace
+
+extern "C" {
+
+__declspec(noalias) bool __stdcall __std_bitset_from_string_1(void* _Dest, const char* _Src, size_t _Size_bytes,
+    size_t _Size_bits, size_t _Size_chars, char _Elem0, char _Elem1) noexcept {
+    using namespace __std_bitset_from_string;
+
+    return _Dispatch<_Traits_1_avx, _Traits_1_sse>(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+}
+
+__declspec(noalias) bool __stdcall __std_bitset_from_string_2(void* _Dest, const wchar_t* _Src, size_t _Size_bytes,
+    size_t _Size_bits, size_t _Size_chars, wchar_t _Elem0, wchar_t _Elem1) noexcept {
+    using namespace __std_bitset_from_string;
+
+    return _Dispatch<_Traits_2_avx, _Traits_2_sse>(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+}
+
+} // extern "C"
+
+namespace {
+    namespace __std_fill {
+        template <class _Ty>
+        void _Fallback(void* const _First, void* const _Last, const _Ty _Val) noexcept {
+            for (auto _Cur = static_cast<_Ty*>(_First); _Cur != _Last; ++_Cur) {
+                *_Cur = _Val;
+            }
+        }
+
+#ifndef _M_ARM64EC
+        template <class _Ty>
+        __m256i _Broadcast_avx(const _Ty _Val) noexcept {
+            if constexpr (sizeof(_Ty) == 2) {
+                return _mm256_set1_epi16(static_cast<short>(_Val));
+            } else if constexpr (sizeof(_Ty) == 4) {
+                return _mm256_set1_epi32(static_cast<int>(_Val));
+            } else {
+                return _mm256_set1_epi64x(static_cast<long long>(_Val));
+            }
+        }
+
+        template <class _Ty>
+        __m128i _Broadcast_sse(const _Ty _Val) noexcept {
+            if constexpr (sizeof(_Ty) == 2) {
+                return _mm_set1_epi16(static_cast<short>(_Val));
+            } else if constexpr (sizeof(_Ty) == 4) {
+                return _mm_set1_epi32(static_cast<int>(_Val));
+            } else {
+                return _mm_set1_epi64x(static_cast<long long>(_Val));
+            }
+        }
+#endif // !defined(_M_ARM64EC)
+
+        template <class _Ty>
+        void _Impl(void* _First, void* const _Last, const _Ty _Val) noexcept {
+#ifndef _M_ARM64EC
+            // Every vector holds the same bytes at element-aligned offsets, so the last vector store may overlap the
+            // previous one instead of leaving a scalar tail.
+            const size_t _Size_bytes = _Byte_length(_First, _Last);
+            if (_Size_bytes >= 32 && _Use_avx2()) {
+                const __m256i _Data = _Broadcast_avx(_Val);
+
+                void* _Stop_at = _First;
+                _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0x1F});
+                do {
+                    _mm256_storeu_si256(static_cast<__m256i*>(_First), _Data);
+                    _Advance_bytes(_First, 32);
+                } while (_First != _Stop_at);
+
+                if (_First != _Last) {
+                    void* _Tail = _Last;
+                    _Rewind_bytes(_Tail, 32);
+                    _mm256_storeu_si256(static_cast<__m256i*>(_Tail), _Data);
+                }
+
+                _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+                return;
+            }
+
+            if (_Size_bytes >= 16 && _Use_sse42()) {
+                const __m128i _Data = _Broadcast_sse(_Val);
+
+                void* _Stop_at = _First;
+                _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0xF});
+                do {
+                    _mm_storeu_si128(static_cast<__m128i*>(_First), _Data);
+                    _Advance_bytes(_First, 16);
+                } while (_First != _Stop_at);
+
+                if (_First != _Last) {
+                    void* _Tail = _Last;
+                    _Rewind_bytes(_Tail, 16);
+                    _mm_storeu_si128(static_cast<__m128i*>(_Tail), _Data);
+                }
+
+                return;
+            }
+#endif // !defined(_M_ARM64EC)
+
+            _Fallback(_First, _Last, _Val);
+        }
+    } // namespace __std_fill
+
+    namespace __std_transform {
+        // Each operation provides a scalar form, which defines the result, and SSE2 and AVX2 forms that compute the
+        // same bits. Integer operations work on unsigned types so that wraparound is well-defined.
+        template <class _Ty>
+        struct _Plus_int {
+            static _Ty _Scalar(const _Ty _Left, const _Ty _Right) noexcept {
+                return static_cast<_Ty>(_Left + _Right);
+            }
+
+#ifndef _M_ARM64EC
+            static __m128i _Sse(const __m128i _Left, const __m128i _Right) noexcept {
+                if constexpr (sizeof(_Ty) == 1) {
+                    return _mm_add_epi8(_Left, _Right);
+                } else if constexpr (sizeof(_Ty) == 2) {
+                    return _mm_add_epi16(_Left, _Right);
+                } else if constexpr (sizeof(_Ty) == 4) {
+                    return _mm_add_epi32(_Left, _Right);
+                } else {
+                    return _mm_add_epi64(_Left, _Right);
+                }
+            }
+
+            static __m256i _Avx(const __m256i _Left, const __m256i _Right) noexcept {
+                if constexpr (sizeof(_Ty) == 1) {
+                    return _mm256_add_epi8(_Left, _Right);
+                } else if constexpr (sizeof(_Ty) == 2) {
+                    return _mm256_add_epi16(_Left, _Right);
+                } else if constexpr (sizeof(_Ty) == 4) {
+                    return _mm256_add_epi32(_Left, _Right);
+                } else {
+                    return _mm256_add_epi64(_Left, _Right);
+                }
+            }
+#endif // !defined(_M_ARM64EC)
+        };
+
+        template <class _Ty>
+        struct _Minus_int {
+            static _Ty _Scalar(const _Ty _Left, const _Ty _Right) noexcept {
+                return static_cast<_Ty>(_Left - _Right);
+            }
+
+#ifndef _M_ARM64EC
+            static __m128i _Sse(const __m128i _Left, const __m128i _Right) noexcept {
+                if constexpr (sizeof(_Ty) == 1) {
+                    return _mm_sub_epi8(_Left, _Right);
+                } else if constexpr (sizeof(_Ty) == 2) {
+                    return _mm_sub_epi16(_Left, _Right);
+                } else if constexpr (sizeof(_Ty) == 4) {
+                    return _mm_sub_epi32(_Left, _Right);
+                } else {
+                    return _mm_sub_epi64(_Left, _Right);
+                }
+            }
+
+            static __m256i _Avx(const __m256i _Left, const __m256i _Right) noexcept {
+                if constexpr (sizeof(_Ty) == 1) {
+                    return _mm256_sub_epi8(_Left, _Right);
+                } else if constexpr (sizeof(_Ty) == 2) {
+                    return _mm256_sub_epi16(_Left, _Right);
+                } else if constexpr (sizeof(_Ty) == 4) {
+                    return _mm256_sub_epi32(_Left, _Right);
+                } else {
+                    return _mm256_sub_epi64(_Left, _Right);
+                }
+            }
+#endif // !defined(_M_ARM64EC)
+        };
+
+        template <class _Ty>
+        struct _Negate_int {
+            static _Ty _Scalar(const _Ty _Val) noexcept {
+                return static_cast<_Ty>(_Ty{0} - _Val);
+            }
+
+#ifndef _M_ARM64EC
+            static __m128i _Sse(const __m128i _Val) noexcept {
+                return _Minus_int<_Ty>::_Sse(_mm_setzero_si128(), _Val);
+            }
+
+            static __m256i _Avx(const __m256i _Val) noexcept {
+                return _Minus_int<_Ty>::_Avx(_mm256_setzero_si256(), _Val);
+            }
+#endif // !defined(_M_ARM64EC)
+        };
+
+        struct _Plus_f {
+            static float _Scalar(const float _Left, const float _Right) noexcept {
+                return _Left + _Right;
+            }
+
+#ifndef _M_ARM64EC
+            static __m128i _Sse(const __m128i _Left, const __m128i _Right) noexcept {
+                return _mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(_Left), _mm_castsi128_ps(_Right)));
+            }
+
+            static __m256i _Avx(const __m256i _Left, const __m256i _Right) noexcept {
+                return _mm256_castps_si256(_mm256_add_ps(_mm256_castsi256_ps(_Left), _mm256_castsi256_ps(_Right)));
+            }
+#endif // !defined(_M_ARM64EC)
+        };
+
+        struct _Plus_d {
+            static double _Scalar(const double _Left, const double _Right) noexcept {
+                return _Left + _Right;
+            }
+
+#ifndef _M_ARM64EC
+            static __m128i _Sse(const __m128i _Left, const __m128i _Right) noexcept {
+                return _mm_castpd_si128(_mm_add_pd(_mm_castsi128_pd(_Left), _mm_castsi128_pd(_Right)));
+            }
+
+            static __m256i _Avx(const __m256i _Left, const __m256i _Right) noexcept {
+                return _mm256_castpd_si256(_mm256_add_pd(_mm256_castsi256_pd(_Left), _mm256_castsi256_pd(_Right)));
+            }
+#endif // !defined(_M_ARM64EC)
+        };
+
+        struct _Minus_f {
+            static float _Scalar(const float _Left, const float _Right) noexcept {
+                return _Left - _Right;
+            }
+
+#ifndef _M_ARM64EC
+            static __m128i _Sse(const __m128i _Left, const __m128i _Right) noexcept {
+                return _mm_castps_si128(_mm_sub_ps(_mm_castsi128_ps(_Left), _mm_castsi128_ps(_Right)));
+            }
+
+            static __m256i _Avx(const __m256i _Left, const __m256i _Right) noexcept {
+                return _mm256_castps_si256(_mm256_sub_ps(_mm256_castsi256_ps(_Left), _mm256_castsi256_ps(_Right)));
+            }
+#endif // !defined(_M_ARM64EC)
+        };
+
+        struct _Minus_d {
+            static double _Scalar(const double _Left, const double _Right) noexcept {
+                return _Left - _Right;
+            }
+
+#ifndef _M_ARM64EC
+            static __m128i _Sse(const __m128i _Left, const __m128i _Right) noexcept {
+                return _mm_castpd_si128(_mm_sub_pd(_mm_castsi128_pd(_Left), _mm_castsi128_pd(_Right)));
+            }
+
+            static __m256i _Avx(const __m256i _Left, const __m256i _Right) noexcept {
+                return _mm256_castpd_si256(_mm256_sub_pd(_mm256_castsi256_pd(_Left), _mm256_castsi256_pd(_Right)));
+            }
+#endif // !defined(_M_ARM64EC)
+        };
+
+        // Negation of floating-point values flips the sign bit, including for zeros and NaNs.
+        template <class _Ty>
+        struct _Negate_fp {
+            static _Ty _Scalar(const _Ty _Val) noexcept {
+                return -_Val;
+            }
+
+#ifndef _M_ARM64EC
+            static __m128i _Sse(const __m128i _Val) noexcept {
+                if constexpr (sizeof(_Ty) == 4) {
+                    return _mm_xor_si128(_Val, _mm_set1_epi32(static_cast<int>(0x8000'0000u)));
+                } else {
+                    return _mm_xor_si128(_Val, _mm_set1_epi64x(static_cast<long long>(0x8000'0000'0000'0000u)));
+                }
+            }
+
+            static __m256i _Avx(const __m256i _Val) noexcept {
+                if constexpr (sizeof(_Ty) == 4) {
+                    return _mm256_xor_si256(_Val, _mm256_set1_epi32(static_cast<int>(0x8000'0000u)));
+                } else {
+                    return _mm256_xor_si256(_Val, _mm256_set1_epi64x(static_cast<long long>(0x8000'0000'0000'0000u)));
+                }
+            }
+#endif // !defined(_M_ARM64EC)
+        };
+
+        // Bitwise operations don't depend on the element size, so they process bytes.
+        struct _Bit_and {
+            static uint8_t _Scalar(const uint8_t _Left, const uint8_t _Right) noexcept {
+                return static_cast<uint8_t>(_Left & _Right);
+            }
+
+#ifndef _M_ARM64EC
+            static __m128i _Sse(const __m128i _Left, const __m128i _Right) noexcept {
+                return _mm_and_si128(_Left, _Right);
+            }
+
+            static __m256i _Avx(const __m256i _Left, const __m256i _Right) noexcept {
+                return _mm256_and_si256(_Left, _Right);
+            }
+#endif // !defined(_M_ARM64EC)
+        };
+
+        struct _Bit_or {
+            static uint8_t _Scalar(const uint8_t _Left, const uint8_t _Right) noexcept {
+                return static_cast<uint8_t>(_Left | _Right);
+            }
+
+#ifndef _M_ARM64EC
+            static __m128i _Sse(const __m128i _Left, const __m128i _Right) noexcept {
+                return _mm_or_si128(_Left, _Right);
+            }
+
+            static __m256i _Avx(const __m256i _Left, const __m256i _Right) noexcept {
+                return _mm256_or_si256(_Left, _Right);
+            }
+#endif // !defined(_M_ARM64EC)
+        };
+
+        struct _Bit_xor {
+            static uint8_t _Scalar(const uint8_t _Left, const uint8_t _Right) noexcept {
+                return static_cast<uint8_t>(_Left ^ _Right);
+            }
+
+#ifndef _M_ARM64EC
+            static __m128i _Sse(const __m128i _Left, const __m128i _Right) noexcept {
+                return _mm_xor_si128(_Left, _Right);
+            }
+
+            static __m256i _Avx(const __m256i _Left, const __m256i _Right) noexcept {
+                return _mm256_xor_si256(_Left, _Right);
+            }
+#endif // !defined(_M_ARM64EC)
+        };
+
+        struct _Bit_not {
+            static uint8_t _Scalar(const uint8_t _Val) noexcept {
+                return static_cast<uint8_t>(~_Val);
+            }
+
+#ifndef _M_ARM64EC
+            static __m128i _Sse(const __m128i _Val) noexcept {
+                return _mm_xor_si128(_Val, _mm_set1_epi32(-1));
+            }
+
+            static __m256i _Avx(const __m256i _Val) noexcept {
+                return _mm256_xor_si256(_Val, _mm256_set1_epi32(-1));
+            }
+#endif // !defined(_M_ARM64EC)
+        };
+
+#ifndef _M_ARM64EC
+        // Vector steps load a whole block of sources before storing the block of results. That gives the same
+        // results as the element-by-element loop when the destination is equal to a source or is before it, but
+        // not when the destination starts inside a source range.
+        bool _Can_vectorize(const void* const _Src, const size_t _Size_bytes, const void* const _Dest) noexcept {
+            const auto _Src_addr  = reinterpret_cast<uintptr_t>(_Src);
+            const auto _Dest_addr = reinterpret_cast<uintptr_t>(_Dest);
+            return _Dest_addr <= _Src_addr || _Dest_addr - _Src_addr >= _Size_bytes;
+        }
+#endif // !defined(_M_ARM64EC)
+
+        template <class _Traits, class _Ty>
+        void _Unary(const void* _First, const void* const _Last, void* _Dest) noexcept {
+#ifndef _M_ARM64EC
+            const size_t _Size_bytes = _Byte_length(_First, _Last);
+            if (_Can_vectorize(_First, _Size_bytes, _Dest)) {
+                if (_Size_bytes >= 32 && _Use_avx2()) {
+                    const void* _Stop_at = _First;
+                    _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0x1F});
+                    do {
+                        const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+                        _mm256_storeu_si256(static_cast<__m256i*>(_Dest), _Traits::_Avx(_Data));
+                        _Advance_bytes(_First, 32);
+                        _Advance_bytes(_Dest, 32);
+                    } while (_First != _Stop_at);
+
+                    _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+                }
+
+                if (_Byte_length(_First, _Last) >= 16 && _Use_sse42()) {
+                    const void* _Stop_at = _First;
+                    _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) & ~size_t{0xF});
+                    do {
+                        const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First));
+                        _mm_storeu_si128(static_cast<__m128i*>(_Dest), _Traits::_Sse(_Data));
+                        _Advance_bytes(_First, 16);
+                        _Advance_bytes(_Dest, 16);
+                    } while (_First != _Stop_at);
+                }
+            }
+#endif // !defined(_M_ARM64EC)
+
+            auto _Dest_el = static_cast<_Ty*>(_Dest);
+            for (auto _Cur = static_cast<const _Ty*>(_First); _Cur != _Last; ++_Cur, ++_Dest_el) {
+                *_Dest_el = _Traits::_Scalar(*_Cur);
+            }
+        }
+
+        template <class _Traits, class _Ty>
+        void _Binary(const void* _First1, const void* const _Last1, const void* _First2, void* _Dest) noexcept {
+#ifndef _M_ARM64EC
+            const size_t _Size_bytes = _Byte_length(_First1, _Last1);
+            if (_Can_vectorize(_First1, _Size_bytes, _Dest) && _Can_vectorize(_First2, _Size_bytes, _Dest)) {
+                if (_Size_bytes >= 32 && _Use_avx2()) {
+                    const void* _Stop_at = _First1;
+                    _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0x1F});
+                    do {
+                        const __m256i _Left  = _mm256_loadu_si256(static_cast<const __m256i*>(_First1));
+                        const __m256i _Right = _mm256_loadu_si256(static_cast<const __m256i*>(_First2));
+                        _mm256_storeu_si256(static_cast<__m256i*>(_Dest), _Traits::_Avx(_Left, _Right));
+                        _Advance_bytes(_First1, 32);
+                        _Advance_bytes(_First2, 32);
+                        _Advance_bytes(_Dest, 32);
+                    } while (_First1 != _Stop_at);
+
+                    _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+                }
+
+                if (_Byte_length(_First1, _Last1) >= 16 && _Use_sse42()) {
+                    const void* _Stop_at = _First1;
+                    _Advance_bytes(_Stop_at, _Byte_length(_First1, _Last1) & ~size_t{0xF});
+                    do {
+                        const __m128i _Left  = _mm_loadu_si128(static_cast<const __m128i*>(_First1));
+                        const __m128i _Right = _mm_loadu_si128(static_cast<const __m128i*>(_First2));
+                        _mm_storeu_si128(static_cast<__m128i*>(_Dest), _Traits::_Sse(_Left, _Right));
+                        _Advance_bytes(_First1, 16);
+                        _Advance_bytes(_First2, 16);
+                        _Advance_bytes(_Dest, 16);
+                    } while (_First1 != _Stop_at);
+                }
+            }
+#endif // !defined(_M_ARM64EC)
+
+            auto _Src2    = static_cast<const _Ty*>(_First2);
+            auto _Dest_el = static_cast<_Ty*>(_Dest);
+            for (auto _Src1 = static_cast<const _Ty*>(_First1); _Src1 != _Last1; ++_Src1, ++_Src2, ++_Dest_el) {
+                *_Dest_el = _Traits::_Scalar(*_Src1, *_Src2);
+            }
+        }
+    } // namespace __std_transform
+} // unnamed namespace
+
+extern "C" {
+
+__declspec(noalias) void __stdcall __std_fill_2(void* const _First, void* const _Last, const uint16_t _Val) noexcept {
+    __std_fill::_Impl(_First, _Last, _Val);
+}
+
+__declspec(noalias) void __stdcall __std_fill_4(void* const _First, void* const _Last, const uint32_t _Val) noexcept {
+    __std_fill::_Impl(_First, _Last, _Val);
+}
+
+__declspec(noalias) void __stdcall __std_fill_8(void* const _First, void* const _Last, const uint64_t _Val) noexcept {
+    __std_fill::_Impl(_First, _Last, _Val);
+}
+
+__declspec(noalias) void __stdcall __std_transform_plus_1(
+    const void* const _First1, const void* const _Last1, const void* const _First2, void* const _Dest) noexcept {
+    using namespace __std_transform;
+    _Binary<_Plus_int<uint8_t>, uint8_t>(_First1, _Last1, _First2, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_transform_plus_2(
+    const void* const _First1, const void* const _Last1, const void* const _First2, void* const _Dest) noexcept {
+    using namespace __std_transform;
+    _Binary<_Plus_int<uint16_t>, uint16_t>(_First1, _Last1, _First2, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_transform_plus_4(
+    const void* const _First1, const void* const _Last1, const void* const _First2, void* const _Dest) noexcept {
+    using namespace __std_transform;
+    _Binary<_Plus_int<uint32_t>, uint32_t>(_First1, _Last1, _First2, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_transform_plus_8(
+    const void* const _First1, const void* const _Last1, const void* const _First2, void* const _Dest) noexcept {
+    using namespace __std_transform;
+    _Binary<_Plus_int<uint64_t>, uint64_t>(_First1, _Last1, _First2, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_transform_plus_f(
+    const void* const _First1, const void* const _Last1, const void* const _First2, void* const _Dest) noexcept {
+    using namespace __std_transform;
+    _Binary<_Plus_f, float>(_First1, _Last1, _First2, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_transform_plus_d(
+    const void* const _First1, const void* const _Last1, const void* const _First2, void* const _Dest) noexcept {
+    using namespace __std_transform;
+    _Binary<_Plus_d, double>(_First1, _Last1, _First2, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_transform_minus_1(
+    const void* const _First1, const void* const _Last1, const void* const _First2, void* const _Dest) noexcept {
+    using namespace __std_transform;
+    _Binary<_Minus_int<uint8_t>, uint8_t>(_First1, _Last1, _First2, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_transform_minus_2(
+    const void* const _First1, const void* const _Last1, const void* const _First2, void* const _Dest) noexcept {
+    using namespace __std_transform;
+    _Binary<_Minus_int<uint16_t>, uint16_t>(_First1, _Last1, _First2, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_transform_minus_4(
+    const void* const _First1, const void* const _Last1, const void* const _First2, void* const _Dest) noexcept {
+    using namespace __std_transform;
+    _Binary<_Minus_int<uint32_t>, uint32_t>(_First1, _Last1, _First2, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_transform_minus_8(
+    const void* const _First1, const void* const _Last1, const void* const _First2, void* const _Dest) noexcept {
+    using namespace __std_transform;
+    _Binary<_Minus_int<uint64_t>, uint64_t>(_First1, _Last1, _First2, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_transform_minus_f(
+    const void* const _First1, const void* const _Last1, const void* const _First2, void* const _Dest) noexcept {
+    using namespace __std_transform;
+    _Binary<_Minus_f, float>(_First1, _Last1, _First2, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_transform_minus_d(
+    const void* const _First1, const void* const _Last1, const void* const _First2, void* const _Dest) noexcept {
+    using namespace __std_transform;
+    _Binary<_Minus_d, double>(_First1, _Last1, _First2, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_transform_bit_and(
+    const void* const _First1, const void* const _Last1, const void* const _First2, void* const _Dest) noexcept {
+    using namespace __std_transform;
+    _Binary<_Bit_and, uint8_t>(_First1, _Last1, _First2, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_transform_bit_or(
+    const void* const _First1, const void* const _Last1, const void* const _First2, void* const _Dest) noexcept {
+    using namespace __std_transform;
+    _Binary<_Bit_or, uint8_t>(_First1, _Last1, _First2, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_transform_bit_xor(
+    const void* const _First1, const void* const _Last1, const void* const _First2, void* const _Dest) noexcept {
+    using namespace __std_transform;
+    _Binary<_Bit_xor, uint8_t>(_First1, _Last1, _First2, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_transform_negate_1(
+    const void* const _First, const void* const _Last, void* const _Dest) noexcept {
+    using namespace __std_transform;
+    _Unary<_Negate_int<uint8_t>, uint8_t>(_First, _Last, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_transform_negate_2(
+    const void* const _First, const void* const _Last, void* const _Dest) noexcept {
+    using namespace __std_transform;
+    _Unary<_Negate_int<uint16_t>, uint16_t>(_First, _Last, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_transform_negate_4(
+    const void* const _First, const void* const _Last, void* const _Dest) noexcept {
+    using namespace __std_transform;
+    _Unary<_Negate_int<uint32_t>, uint32_t>(_First, _Last, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_transform_negate_8(
+    const void* const _First, const void* const _Last, void* const _Dest) noexcept {
+    using namespace __std_transform;
+    _Unary<_Negate_int<uint64_t>, uint64_t>(_First, _Last, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_transform_negate_f(
+    const void* const _First, const void* const _Last, void* const _Dest) noexcept {
+    using namespace __std_transform;
+    _Unary<_Negate_fp<float>, float>(_First, _Last, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_transform_negate_d(
+    const void* const _First, const void* const _Last, void* const _Dest) noexcept {
+    using namespace __std_transform;
+    _Unary<_Negate_fp<double>, double>(_First, _Last, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_transform_bit_not(
+    const void* const _First, const void* const _Last, void* const _Dest) noexcept {
+    using namespace __std_transform;
+    _Unary<_Bit_not, uint8_t>(_First, _Last, _Dest);
+}
+
+} // extern "C"
+
+namespace {
+    namespace __std_lower_bound_batch {
+        // Binary searches of a sorted array of 4-byte integers for many independent keys. Each search takes the same
+        // branchless steps for a given array size: the answer lies in [_Base, _Base + _Count], and comparing
+        // _Base[_Count / 2] with the key halves that, rounding up. Searches for different keys advance in lockstep,
+        // so their memory accesses overlap instead of each one waiting for the previous cache miss.
+
+        // Beyond this many bytes, the array is unlikely to stay in the L2 cache. Then, each step prefetches both
+        // elements that the step after it could probe. Once a step's candidates share a cache line, that stops.
+        constexpr size_t _Prefetch_threshold_bytes = size_t{1} << 18;
+        constexpr size_t _Prefetch_min_half        = 64 / sizeof(uint32_t);
+
+        void _Prefetch(const void* const _Ptr) noexcept {
+#ifndef _M_ARM64EC
+            _mm_prefetch(static_cast<const char*>(_Ptr), _MM_HINT_T0);
+#else // ^^^ !defined(_M_ARM64EC) / defined(_M_ARM64EC) vvv
+            (void) _Ptr;
+#endif // ^^^ defined(_M_ARM64EC) ^^^
+        }
+
+        template <class _Ty>
+        size_t _Scalar(const _Ty* const _First, size_t _Count, const _Ty _Key, const bool _Use_prefetch) noexcept {
+            // _Count must be nonzero.
+            size_t _Base = 0;
+            while (_Count > 1) {
+                const size_t _Half      = _Count / 2;
+                const size_t _Next_half = (_Count - _Half) / 2;
+                if (_Use_prefetch && _Next_half >= _Prefetch_min_half) {
+                    _Prefetch(_First + _Base + _Next_half);
+                    _Prefetch(_First + _Base + _Half + _Next_half);
+                }
+
+                _Base += _First[_Base + _Half] < _Key ? _Half : 0;
+                _Count -= _Half;
+            }
+
+            return _Base + (_First[_Base] < _Key ? 1 : 0);
+        }
+
+#ifndef _M_ARM64EC
+        template <class _Ty, size_t _Vectors>
+        void _Avx2(const _Ty* const _First, const size_t _Count, const _Ty* const _Keys, size_t* const _Dest,
+            const bool _Use_prefetch) noexcept {
+            // _Count must be within [1, INT_MAX]. Processes 8 * _Vectors keys.
+            const auto _Hay = reinterpret_cast<const int*>(_First);
+
+            // Flipping the sign bit makes a signed comparison order unsigned values.
+            const __m256i _Flip = _mm256_set1_epi32(static_cast<_Ty>(-1) < _Ty{0} ? 0 : static_cast<int>(0x8000'0000u));
+
+            __m256i _Key[_Vectors];
+            __m256i _Base[_Vectors];
+            for (size_t _Ix = 0; _Ix != _Vectors; ++_Ix) {
+                const __m256i _Data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Keys) + _Ix);
+                _Key[_Ix]           = _mm256_xor_si256(_Data, _Flip);
+                _Base[_Ix]          = _mm256_setzero_si256();
+            }
+
+            for (size_t _Len = _Count; _Len > 1;) {
+                const size_t _Half      = _Len / 2;
+                const size_t _Next_half = (_Len - _Half) / 2;
+                const __m256i _Half_v   = _mm256_set1_epi32(static_cast<int>(_Half));
+                const bool _Prefetching = _Use_prefetch && _Next_half >= _Prefetch_min_half;
+
+                for (size_t _Ix = 0; _Ix != _Vectors; ++_Ix) {
+                    if (_Prefetching) {
+                        alignas(32) uint32_t _Bases[8];
+                        _mm256_store_si256(reinterpret_cast<__m256i*>(_Bases), _Base[_Ix]);
+                        for (const uint32_t _Lane_base : _Bases) {
+                            _Prefetch(_First + _Lane_base + _Next_half);
+                            _Prefetch(_First + _Lane_base + _Half + _Next_half);
+                        }
+                    }
+
+                    const __m256i _Probe = _mm256_add_epi32(_Base[_Ix], _Half_v);
+                    const __m256i _Data  = _mm256_xor_si256(_mm256_i32gather_epi32(_Hay, _Probe, 4), _Flip);
+                    const __m256i _Less  = _mm256_cmpgt_epi32(_Key[_Ix], _Data);
+                    _Base[_Ix]           = _mm256_add_epi32(_Base[_Ix], _mm256_and_si256(_Less, _Half_v));
+                }
+
+                _Len -= _Half;
+            }
+
+            for (size_t _Ix = 0; _Ix != _Vectors; ++_Ix) {
+                const __m256i _Data   = _mm256_xor_si256(_mm256_i32gather_epi32(_Hay, _Base[_Ix], 4), _Flip);
+                const __m256i _Less   = _mm256_cmpgt_epi32(_Key[_Ix], _Data);
+                const __m256i _Result = _mm256_sub_epi32(_Base[_Ix], _Less); // _Less is -1 where the key is greater
+
+                if constexpr (sizeof(size_t) == 8) {
+                    const __m256i _Low  = _mm256_cvtepu32_epi64(_mm256_castsi256_si128(_Result));
+                    const __m256i _High = _mm256_cvtepu32_epi64(_mm256_extracti128_si256(_Result, 1));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest + _Ix * 8), _Low);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest + _Ix * 8 + 4), _High);
+                } else {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest + _Ix * 8), _Result);
+                }
+            }
+        }
+#endif // !defined(_M_ARM64EC)
+
+        template <class _Ty>
+        void _Impl(const void* const _First_raw, const size_t _Count, const void* _First_key_raw,
+            const void* const _Last_key_raw, size_t* _Dest) noexcept {
+            const auto _First       = static_cast<const _Ty*>(_First_raw);
+            auto _First_key         = static_cast<const _Ty*>(_First_key_raw);
+            const auto _Last_key    = static_cast<const _Ty*>(_Last_key_raw);
+            const bool _Use_prefetch = _Count * sizeof(_Ty) > _Prefetch_threshold_bytes;
+
+            if (_Count == 0) {
+                for (; _First_key != _Last_key; ++_First_key, ++_Dest) {
+                    *_Dest = 0;
+                }
+
+                return;
+            }
+
+#ifndef _M_ARM64EC
+            if (_Count <= size_t{INT32_MAX} && _Use_avx2()) {
+                constexpr size_t _Group = 32;
+                while (static_cast<size_t>(_Last_key - _First_key) >= _Group) {
+                    _Avx2<_Ty, _Group / 8>(_First, _Count, _First_key, _Dest, _Use_prefetch);
+                    _First_key += _Group;
+                    _Dest += _Group;
+                }
+
+                while (static_cast<size_t>(_Last_key - _First_key) >= 8) {
+                    _Avx2<_Ty, 1>(_First, _Count, _First_key, _Dest, _Use_prefetch);
+                    _First_key += 8;
+                    _Dest += 8;
+                }
+
+                _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+            }
+#endif // !defined(_M_ARM64EC)
+
+            for (; _First_key != _Last_key; ++_First_key, ++_Dest) {
+                *_Dest = _Scalar(_First, _Count, *_First_key, _Use_prefetch);
+            }
+        }
+    } // namespace __std_lower_bound_batch
+} // unnamed namespace
+
+extern "C" {
+
+__declspec(noalias) void __stdcall __std_lower_bound_batch_4i(const void* const _First, const size_t _Count,
+    const void* const _First_key, const void* const _Last_key, size_t* const _Dest) noexcept {
+    __std_lower_bound_batch::_Impl<int32_t>(_First, _Count, _First_key, _Last_key, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_lower_bound_batch_4u(const void* const _First, const size_t _Count,
+    const void* const _First_key, const void* const _Last_key, size_t* const _Dest) noexcept {
+    __std_lower_bound_batch::_Impl<uint32_t>(_First, _Count, _First_key, _Last_key, _Dest);
+}
+
+} // extern "C"
+
+namespace {
+    namespace __std_reduce {
+        // Each operation reuses the vector forms of transform's operation, and adds a scalar form for the element
+        // type and the identity value that starts each vector accumulator. Reordering the operations is exact for
+        // integers; reduce permits it for floating-point sums. (Minimum and maximum reductions are the existing
+        // __std_min_* and __std_max_* functions.)
+        template <class _Ty>
+        struct _Sum_int : __std_transform::_Plus_int<_Ty> {
+            static constexpr _Ty _Identity = 0;
+        };
+
+        struct _Sum_f : __std_transform::_Plus_f {
+            static constexpr float _Identity = -0.0f; // unlike +0.0f, leaves -0.0f unchanged
+        };
+
+        struct _Sum_d : __std_transform::_Plus_d {
+            static constexpr double _Identity = -0.0;
+        };
+
+        template <class _Ty>
+        struct _Bit_and : __std_transform::_Bit_and {
+            static constexpr _Ty _Identity = static_cast<_Ty>(~_Ty{0});
+
+            static _Ty _Scalar(const _Ty _Left, const _Ty _Right) noexcept {
+                return static_cast<_Ty>(_Left & _Right);
+            }
+        };
+
+        template <class _Ty>
+        struct _Bit_or : __std_transform::_Bit_or {
+            static constexpr _Ty _Identity = 0;
+
+            static _Ty _Scalar(const _Ty _Left, const _Ty _Right) noexcept {
+                return static_cast<_Ty>(_Left | _Right);
+            }
+        };
+
+        template <class _Ty>
+        struct _Bit_xor : __std_transform::_Bit_xor {
+            static constexpr _Ty _Identity = 0;
+
+            static _Ty _Scalar(const _Ty _Left, const _Ty _Right) noexcept {
+                return static_cast<_Ty>(_Left ^ _Right);
+            }
+        };
+
+        template <class _Traits, class _Ty>
+        _Ty _Impl(const void* _First, const void* const _Last, _Ty _Val) noexcept {
+#ifndef _M_ARM64EC
+            // Several independent accumulators hide the latency of each operation, which matters most for
+            // floating-point addition. At the end, the lanes of the accumulators are folded into _Val.
+            const size_t _Size_bytes = _Byte_length(_First, _Last);
+            if (_Size_bytes >= 32 && _Use_avx2()) {
+                alignas(32) _Ty _Lanes[32 / sizeof(_Ty)];
+                for (auto& _Lane : _Lanes) {
+                    _Lane = _Traits::_Identity;
+                }
+
+                const __m256i _Identity = _mm256_load_si256(reinterpret_cast<const __m256i*>(_Lanes));
+                __m256i _Acc[4]         = {_Identity, _Identity, _Identity, _Identity};
+
+                const void* _Stop_at = _First;
+                _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0x7F});
+                while (_First != _Stop_at) {
+                    for (size_t _Ix = 0; _Ix != 4; ++_Ix) {
+                        const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First) + _Ix);
+                        _Acc[_Ix]           = _Traits::_Avx(_Acc[_Ix], _Data);
+                    }
+
+                    _Advance_bytes(_First, 128);
+                }
+
+                _Advance_bytes(_Stop_at, _Size_bytes & 0x60);
+                while (_First != _Stop_at) {
+                    _Acc[0] = _Traits::_Avx(_Acc[0], _mm256_loadu_si256(static_cast<const __m256i*>(_First)));
+                    _Advance_bytes(_First, 32);
+                }
+
+                _Acc[0] = _Traits::_Avx(_Traits::_Avx(_Acc[0], _Acc[1]), _Traits::_Avx(_Acc[2], _Acc[3]));
+                _mm256_store_si256(reinterpret_cast<__m256i*>(_Lanes), _Acc[0]);
+                _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+
+                for (const auto _Lane : _Lanes) {
+                    _Val = _Traits::_Scalar(_Val, _Lane);
+                }
+            } else if (_Size_bytes >= 16 && _Use_sse42()) {
+                alignas(16) _Ty _Lanes[16 / sizeof(_Ty)];
+                for (auto& _Lane : _Lanes) {
+                    _Lane = _Traits::_Identity;
+                }
+
+                const __m128i _Identity = _mm_load_si128(reinterpret_cast<const __m128i*>(_Lanes));
+                __m128i _Acc[4]         = {_Identity, _Identity, _Identity, _Identity};
+
+                const void* _Stop_at = _First;
+                _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0x3F});
+                while (_First != _Stop_at) {
+                    for (size_t _Ix = 0; _Ix != 4; ++_Ix) {
+                        const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First) + _Ix);
+                        _Acc[_Ix]           = _Traits::_Sse(_Acc[_Ix], _Data);
+                    }
+
+                    _Advance_bytes(_First, 64);
+                }
+
+                _Advance_bytes(_Stop_at, _Size_bytes & 0x30);
+                while (_First != _Stop_at) {
+                    _Acc[0] = _Traits::_Sse(_Acc[0], _mm_loadu_si128(static_cast<const __m128i*>(_First)));
+                    _Advance_bytes(_First, 16);
+                }
+
+                _Acc[0] = _Traits::_Sse(_Traits::_Sse(_Acc[0], _Acc[1]), _Traits::_Sse(_Acc[2], _Acc[3]));
+                _mm_store_si128(reinterpret_cast<__m128i*>(_Lanes), _Acc[0]);
+
+                for (const auto _Lane : _Lanes) {
+                    _Val = _Traits::_Scalar(_Val, _Lane);
+                }
+            }
+#endif // !defined(_M_ARM64EC)
+
+            for (auto _Cur = static_cast<const _Ty*>(_First); _Cur != _Last; ++_Cur) {
+                _Val = _Traits::_Scalar(_Val, *_Cur);
+            }
+
+            return _Val;
+        }
+    } // namespace __std_reduce
+} // unnamed namespace
+
+extern "C" {
+
+__declspec(noalias) uint8_t __stdcall __std_reduce_sum_1(
+    const void* const _First, const void* const _Last, const uint8_t _Val) noexcept {
+    return __std_reduce::_Impl<__std_reduce::_Sum_int<uint8_t>>(_First, _Last, _Val);
+}
+
+__declspec(noalias) uint16_t __stdcall __std_reduce_sum_2(
+    const void* const _First, const void* const _Last, const uint16_t _Val) noexcept {
+    return __std_reduce::_Impl<__std_reduce::_Sum_int<uint16_t>>(_First, _Last, _Val);
+}
+
+__declspec(noalias) uint32_t __stdcall __std_reduce_sum_4(
+    const void* const _First, const void* const _Last, const uint32_t _Val) noexcept {
+    return __std_reduce::_Impl<__std_reduce::_Sum_int<uint32_t>>(_First, _Last, _Val);
+}
+
+__declspec(noalias) uint64_t __stdcall __std_reduce_sum_8(
+    const void* const _First, const void* const _Last, const uint64_t _Val) noexcept {
+    return __std_reduce::_Impl<__std_reduce::_Sum_int<uint64_t>>(_First, _Last, _Val);
+}
+
+__declspec(noalias) float __stdcall __std_reduce_sum_f(
+    const void* const _First, const void* const _Last, const float _Val) noexcept {
+    return __std_reduce::_Impl<__std_reduce::_Sum_f>(_First, _Last, _Val);
+}
+
+__declspec(noalias) double __stdcall __std_reduce_sum_d(
+    const void* const _First, const void* const _Last, const double _Val) noexcept {
+    return __std_reduce::_Impl<__std_reduce::_Sum_d>(_First, _Last, _Val);
+}
+
+__declspec(noalias) uint8_t __stdcall __std_reduce_bit_and_1(
+    const void* const _First, const void* const _Last, const uint8_t _Val) noexcept {
+    return __std_reduce::_Impl<__std_reduce::_Bit_and<uint8_t>>(_First, _Last, _Val);
+}
+
+__declspec(noalias) uint16_t __stdcall __std_reduce_bit_and_2(
+    const void* const _First, const void* const _Last, const uint16_t _Val) noexcept {
+    return __std_reduce::_Impl<__std_reduce::_Bit_and<uint16_t>>(_First, _Last, _Val);
+}
+
+__declspec(noalias) uint32_t __stdcall __std_reduce_bit_and_4(
+    const void* const _First, const void* const _Last, const uint32_t _Val) noexcept {
+    return __std_reduce::_Impl<__std_reduce::_Bit_and<uint32_t>>(_First, _Last, _Val);
+}
+
+__declspec(noalias) uint64_t __stdcall __std_reduce_bit_and_8(
+    const void* const _First, const void* const _Last, const uint64_t _Val) noexcept {
+    return __std_reduce::_Impl<__std_reduce::_Bit_and<uint64_t>>(_First, _Last, _Val);
+}
+
+__declspec(noalias) uint8_t __stdcall __std_reduce_bit_or_1(
+    const void* const _First, const void* const _Last, const uint8_t _Val) noexcept {
+    return __std_reduce::_Impl<__std_reduce::_Bit_or<uint8_t>>(_First, _Last, _Val);
+}
+
+__declspec(noalias) uint16_t __stdcall __std_reduce_bit_or_2(
+    const void* const _First, const void* const _Last, const uint16_t _Val) noexcept {
+    return __std_reduce::_Impl<__std_reduce::_Bit_or<uint16_t>>(_First, _Last, _Val);
+}
+
+__declspec(noalias) uint32_t __stdcall __std_reduce_bit_or_4(
+    const void* const _First, const void* const _Last, const uint32_t _Val) noexcept {
+    return __std_reduce::_Impl<__std_reduce::_Bit_or<uint32_t>>(_First, _Last, _Val);
+}
+
+__declspec(noalias) uint64_t __stdcall __std_reduce_bit_or_8(
+    const void* const _First, const void* const _Last, const uint64_t _Val) noexcept {
+    return __std_reduce::_Impl<__std_reduce::_Bit_or<uint64_t>>(_First, _Last, _Val);
+}
+
+__declspec(noalias) uint8_t __stdcall __std_reduce_bit_xor_1(
+    const void* const _First, const void* const _Last, const uint8_t _Val) noexcept {
+    return __std_reduce::_Impl<__std_reduce::_Bit_xor<uint8_t>>(_First, _Last, _Val);
+}
+
+__declspec(noalias) uint16_t __stdcall __std_reduce_bit_xor_2(
+    const void* const _First, const void* const _Last, const uint16_t _Val) noexcept {
+    return __std_reduce::_Impl<__std_reduce::_Bit_xor<uint16_t>>(_First, _Last, _Val);
+}
+
+__declspec(noalias) uint32_t __stdcall __std_reduce_bit_xor_4(
+    const void* const _First, const void* const _Last, const uint32_t _Val) noexcept {
+    return __std_reduce::_Impl<__std_reduce::_Bit_xor<uint32_t>>(_First, _Last, _Val);
+}
+
+__declspec(noalias) uint64_t __stdcall __std_reduce_bit_xor_8(
+    const void* const _First, const void* const _Last, const uint64_t _Val) noexcept {
+    return __std_reduce::_Impl<__std_reduce::_Bit_xor<uint64_t>>(_First, _Last, _Val);
+}
+} // extern "C"
+
+namespace {
+    namespace __std_rotate {
+        // When one side of the rotation is at most this many bytes, it goes through a buffer on the stack, so the
+        // other side moves only once, with memmove.
+        constexpr size_t _Buffer_size = 2048;
+
+        void _Rotate_with_buffer(unsigned char* const _First, unsigned char* const _Mid, const size_t _Left_size,
+            const size_t _Right_size) noexcept {
+            alignas(32) unsigned char _Buffer[_Buffer_size];
+            if (_Left_size <= _Right_size) {
+                memcpy(_Buffer, _First, _Left_size);
+                memmove(_First, _Mid, _Right_size);
+                memcpy(_First + _Right_size, _Buffer, _Left_size);
+            } else {
+                memcpy(_Buffer, _Mid, _Right_size);
+                memmove(_First + _Right_size, _First, _Left_size);
+                memcpy(_First, _Buffer, _Right_size);
+            }
+        }
+    } // namespace __std_rotate
+} // unnamed namespace
+
+extern "C" {
+
+__declspec(noalias) void __stdcall __std_rotate(
+    void* const _First_raw, void* const _Mid_raw, void* const _Last_raw) noexcept {
+    // Rotating elements is rotating their bytes, as _Mid is on an element boundary.
+    auto _First = static_cast<unsigned char*>(_First_raw);
+    auto _Mid   = static_cast<unsigned char*>(_Mid_raw);
+    auto _Last  = static_cast<unsigned char*>(_Last_raw);
+
+    // Block swaps (Gries and Mills): swapping the shorter side with the equally long block of the longer side that is
+    // adjacent to it puts that block in place, and leaves a smaller rotation of the shorter side with the rest of the
+    // longer side. Once the shorter side fits in the buffer, finish with one memmove.
+    for (;;) {
+        const size_t _Left_size  = static_cast<size_t>(_Mid - _First);
+        const size_t _Right_size = static_cast<size_t>(_Last - _Mid);
+        if (_Left_size == 0 || _Right_size == 0) {
+            return;
+        }
+
+        if (_Left_size <= __std_rotate::_Buffer_size || _Right_size <= __std_rotate::_Buffer_size) {
+            __std_rotate::_Rotate_with_buffer(_First, _Mid, _Left_size, _Right_size);
+            return;
+        }
+
+        if (_Left_size <= _Right_size) {
+            // [A B1 B2] with |B1| == |A| becomes [B1 A B2]; then rotate [A B2].
+            __std_swap_ranges_trivially_swappable_noalias(_First, _Mid, _Mid);
+            _First = _Mid;
+            _Mid += _Left_size;
+        } else {
+            // [A1 A2 B] with |A2| == |B| becomes [A1 B A2]; then rotate [A1 B].
+            __std_swap_ranges_trivially_swappable_noalias(_Mid - _Right_size, _Mid, _Mid);
+            _Last = _Mid;
+            _Mid -= _Right_size;
+        }
+    }
+}
+
+} // extern "C"
+
+namespace {
+    namespace __std_flat_hash {
+        // Control bytes of stdext::flat_hash_map and flat_hash_set: a full slot's byte holds 7 bits of its element's
+        // hash, and the other bytes have the high bit set. See _Flat_hash in <xhash>.
+        constexpr unsigned char _Empty = 0x80;
+        constexpr size_t _Group_size   = 16;
+
+        uint32_t _Match_fallback(const unsigned char* const _Group, const unsigned char _Tag) noexcept {
+            uint32_t _Result = 0;
+            for (uint32_t _Idx = 0; _Idx != _Group_size; ++_Idx) {
+                _Result |= static_cast<uint32_t>(_Group[_Idx] == _Tag) << _Idx;
+                _Result |= static_cast<uint32_t>(_Group[_Idx] == _Empty) << (_Idx + 16);
+            }
+
+            return _Result;
+        }
+
+        uint32_t _Match_free_fallback(const unsigned char* const _Group) noexcept {
+            uint32_t _Result = 0;
+            for (uint32_t _Idx = 0; _Idx != _Group_size; ++_Idx) {
+                _Result |= static_cast<uint32_t>(_Group[_Idx] >> 7) << _Idx;
+            }
+
+            return _Result;
+        }
+    } // namespace __std_flat_hash
+} // unnamed namespace
+
+extern "C" {
+
+__declspec(noalias) uint32_t __stdcall __std_flat_hash_match_16(
+    const void* const _Group, const unsigned char _Tag) noexcept {
+#ifndef _M_ARM64EC
+    // A group is 16 bytes, so AVX2 would not help here; everything below is SSE2.
+    if (_Use_sse2()) {
+        const __m128i _Data  = _mm_loadu_si128(static_cast<const __m128i*>(_Group));
+        const __m128i _Tags  = _mm_set1_epi8(static_cast<char>(_Tag));
+        const __m128i _Empty = _mm_set1_epi8(static_cast<char>(__std_flat_hash::_Empty));
+        const auto _Matches  = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_Data, _Tags)));
+        const auto _Empties  = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_Data, _Empty)));
+        return _Matches | (_Empties << 16);
+    }
+#endif // !defined(_M_ARM64EC)
+
+    return __std_flat_hash::_Match_fallback(static_cast<const unsigned char*>(_Group), _Tag);
+}
+
+__declspec(noalias) uint32_t __stdcall __std_flat_hash_match_free_16(const void* const _Group) noexcept {
+#ifndef _M_ARM64EC
+    if (_Use_sse2()) {
+        // empty and deleted bytes are exactly the ones with the high bit set
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(static_cast<const __m128i*>(_Group))));
+    }
+#endif // !defined(_M_ARM64EC)
+
+    return __std_flat_hash::_Match_free_fallback(static_cast<const unsigned char*>(_Group));
 }
 
 } // extern "C"
@@ -240,6 +240,28 @@ void test_filesystem() {
     assert(info.capacity != static_cast<decltype(info.capacity)>(-1));
 }
 
+#if TEST_STANDARD >= 23
+void test_flat_map() {
+    using namespace std;
+    puts("Testing <flat_map>.");
+    flat_map<int, int> fm{{30, 33}, {10, 11}, {20, 22}};
+    assert(fm[20] == 22);
+    assert(fm.begin()->first == 10);
+    flat_multimap<int, int> fmm{{10, 11}, {10, 12}};
+    assert(fmm.count(10) == 2);
+}
+
+void test_flat_set() {
+    using namespace std;
+    puts("Testing <flat_set>.");
+    flat_set<int> fs{30, 10, 20, 10};
+    assert(fs.size() == 3);
+    assert(*fs.begin() == 10);
+    flat_multiset<int> fms{10, 10};
+    assert(fms.count(10) == 2);
+}
+#endif // TEST_STANDARD >= 23
+
 void test_format() {
     using namespace std;
     puts("Testing <format>.");
@@ -305,6 +327,18 @@ void test_initializer_list() {
     assert(il.begin()[2] == 30);
 }
 
+#if TEST_STANDARD >= 23
+void test_inplace_vector() {
+    using namespace std;
+    puts("Testing <inplace_vector>.");
+    inplace_vector<int, 4> iv{10, 20, 30};
+    assert(iv.try_push_back(40) != nullptr);
+    assert(iv.try_push_back(50) == nullptr);
+    assert(iv.size() == 4);
+    assert(iv[3] == 40);
+}
+#endif // TEST_STANDARD >= 23
+
 void test_iomanip() {
     using namespace std;
     puts("Testing <iomanip>.");
@@ -1191,6 +1225,10 @@ void all_cpp_header_tests() {
     test_expected();
 #endif // TEST_STANDARD >= 23
     test_filesystem();
+#if TEST_STANDARD >= 23
+    test_flat_map();
+    test_flat_set();
+#endif // TEST_STANDARD >= 23
     test_format();
     test_forward_list();
     test_fstream();
@@ -1200,6 +1238,9 @@ void all_cpp_header_tests() {
     test_generator();
 #endif // TEST_STANDARD >= 23
     test_initializer_list();
+#if TEST_STANDARD >= 23
+    test_inplace_vector();
+#endif // TEST_STANDARD >= 23
     test_iomanip();
     test_ios();
     test_iosfwd();
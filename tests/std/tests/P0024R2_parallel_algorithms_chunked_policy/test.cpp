@@ -0,0 +1,142 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using stdext::execution::par_chunked;
+using stdext::execution::parallel_chunked_policy;
+
+static_assert(is_execution_policy_v<parallel_chunked_policy>);
+static_assert(is_execution_policy_v<const parallel_chunked_policy&>);
+static_assert(is_base_of_v<execution::parallel_policy, parallel_chunked_policy>);
+
+static_assert(par_chunked.min_chunk_size() == 1);
+static_assert(par_chunked.max_parallelism() == 0);
+static_assert(par_chunked.with_grain(0).min_chunk_size() == 1);
+static_assert(par_chunked.with_grain(4096).min_chunk_size() == 4096);
+static_assert(par_chunked.with_grain(4096).with_max_parallelism(3).min_chunk_size() == 4096);
+static_assert(par_chunked.with_grain(4096).with_max_parallelism(3).max_parallelism() == 3);
+static_assert(par_chunked.with_max_parallelism(3).with_max_parallelism(0).max_parallelism() == 0);
+
+const parallel_chunked_policy policies[] = {
+    par_chunked,
+    par_chunked.with_grain(7),
+    par_chunked.with_grain(1'000'000),
+    par_chunked.with_max_parallelism(1),
+    par_chunked.with_max_parallelism(2),
+    par_chunked.with_grain(3).with_max_parallelism(2),
+};
+
+void test_case_chunked_policy(const size_t testSize, mt19937& gen) {
+    vector<unsigned int> source(testSize);
+    generate(source.begin(), source.end(), ref(gen));
+    vector<unsigned int> sorted = source;
+    sort(sorted.begin(), sorted.end());
+    const auto expectedSum   = accumulate(source.begin(), source.end(), 0ULL);
+    const auto expectedCount = count_if(source.begin(), source.end(), [](unsigned int x) { return x % 3 == 0; });
+
+    for (const auto& policy : policies) {
+        vector<atomic<unsigned int>> visited(testSize);
+        for_each(policy, visited.begin(), visited.end(), [](atomic<unsigned int>& x) { ++x; });
+        assert(all_of(visited.begin(), visited.end(), [](const atomic<unsigned int>& x) { return x.load() == 1; }));
+
+        vector<unsigned long long> widened(testSize);
+        transform(policy, source.begin(), source.end(), widened.begin(),
+            [](unsigned int x) { return static_cast<unsigned long long>(x); });
+        assert(equal(widened.begin(), widened.end(), source.begin(), source.end()));
+        assert(reduce(policy, widened.begin(), widened.end()) == expectedSum);
+        assert(count_if(policy, source.begin(), source.end(), [](unsigned int x) { return x % 3 == 0; })
+               == expectedCount);
+
+        vector<unsigned int> work = source;
+        sort(policy, work.begin(), work.end());
+        assert(work == sorted);
+
+        work = source;
+        stable_sort(policy, work.begin(), work.end());
+        assert(work == sorted);
+    }
+}
+
+void test_max_parallelism_one_stays_on_calling_thread() {
+    const auto caller = this_thread::get_id();
+    vector<int> values(max_parallel_test_case_n * 4);
+    for_each(par_chunked.with_max_parallelism(1), values.begin(), values.end(),
+        [&](int&) { assert(this_thread::get_id() == caller); });
+}
+
+struct concurrency_probe { // a less-than that records the most threads ever inside it at once
+    atomic<size_t>* active;
+    atomic<size_t>* peak;
+
+    bool operator()(const unsigned int left, const unsigned int right) const {
+        const size_t now = ++*active;
+        size_t seen      = peak->load();
+        while (seen < now && !peak->compare_exchange_weak(seen, now)) {
+        }
+
+        --*active;
+        return left < right;
+    }
+};
+
+void test_selection_honors_policy_limits(mt19937& gen) {
+    // nth_element, partial_sort, and partial_sort_copy finish with a sort, which must run under the same limits
+    constexpr size_t testSize = 100'000;
+    vector<unsigned int> source(testSize);
+    generate(source.begin(), source.end(), ref(gen));
+    vector<unsigned int> sorted = source;
+    sort(sorted.begin(), sorted.end());
+    const auto mid = static_cast<ptrdiff_t>(testSize / 2);
+
+    const pair<parallel_chunked_policy, size_t> limits[] = {
+        {par_chunked.with_max_parallelism(2), 2},
+        {par_chunked.with_grain(testSize), 1}, // one chunk
+    };
+
+    for (const auto& [policy, maxThreads] : limits) {
+        atomic<size_t> active{0};
+        atomic<size_t> peak{0};
+        const concurrency_probe probe{&active, &peak};
+
+        vector<unsigned int> work = source;
+        nth_element(policy, work.begin(), work.begin() + mid, work.end(), probe);
+        assert(work[static_cast<size_t>(mid)] == sorted[static_cast<size_t>(mid)]);
+
+        work = source;
+        partial_sort(policy, work.begin(), work.begin() + mid, work.end(), probe);
+        assert(equal(work.begin(), work.begin() + mid, sorted.begin()));
+
+        vector<unsigned int> dest(testSize);
+        partial_sort_copy(policy, source.begin(), source.end(), dest.begin(), dest.end(), probe);
+        assert(dest == sorted);
+
+        dest.resize(static_cast<size_t>(mid));
+        partial_sort_copy(policy, source.begin(), source.end(), dest.begin(), dest.end(), probe);
+        assert(equal(dest.begin(), dest.end(), sorted.begin()));
+
+        assert(peak.load() <= maxThreads);
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+
+    parallel_test_case(test_case_chunked_policy, gen);
+    test_max_parallelism_one_stays_on_calling_thread();
+    test_selection_honors_policy_limits(gen);
+}
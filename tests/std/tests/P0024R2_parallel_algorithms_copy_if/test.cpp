@@ -0,0 +1,95 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <execution>
+#include <functional>
+#include <list>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+const auto is_odd    = [](unsigned int i) { return (i & 0x1u) != 0; };
+const auto same_tens = [](unsigned int a, unsigned int b) { return a / 10 == b / 10; };
+
+template <template <class...> class Container>
+void test_case_copy_if_family_parallel(const size_t testSize, mt19937& gen) {
+    vector<unsigned int> tmp(testSize);
+    const Container<unsigned int> source(tmp.begin(), tmp.end());
+    vector<unsigned int> expected(testSize);
+    vector<unsigned int> expected2(testSize);
+    vector<unsigned int> actual(testSize);
+    vector<unsigned int> actual2(testSize);
+
+    // select nothing and everything:
+    assert(copy_if(par, source.begin(), source.end(), actual.begin(), is_odd) == actual.begin());
+    assert(remove_copy_if(par, source.begin(), source.end(), actual.begin(), is_odd) == actual.end());
+    assert(remove_copy(par, source.begin(), source.end(), actual.begin(), 0U) == actual.begin());
+
+    // "fuzz" testing:
+    uniform_int_distribution<unsigned int> dist(0, 99);
+    for (int i = 0; i < 10; ++i) {
+        generate(tmp.begin(), tmp.end(), [&] { return dist(gen); });
+        const Container<unsigned int> c(tmp.begin(), tmp.end());
+
+        auto expectedEnd = copy_if(tmp.begin(), tmp.end(), expected.begin(), is_odd);
+        auto actualEnd   = copy_if(par, c.begin(), c.end(), actual.begin(), is_odd);
+        assert(equal(expected.begin(), expectedEnd, actual.begin(), actualEnd));
+
+        expectedEnd = remove_copy_if(tmp.begin(), tmp.end(), expected.begin(), is_odd);
+        actualEnd   = remove_copy_if(par, c.begin(), c.end(), actual.begin(), is_odd);
+        assert(equal(expected.begin(), expectedEnd, actual.begin(), actualEnd));
+
+        expectedEnd = remove_copy(tmp.begin(), tmp.end(), expected.begin(), 42U);
+        actualEnd   = remove_copy(par, c.begin(), c.end(), actual.begin(), 42U);
+        assert(equal(expected.begin(), expectedEnd, actual.begin(), actualEnd));
+
+        const auto expectedEnds = partition_copy(tmp.begin(), tmp.end(), expected.begin(), expected2.begin(), is_odd);
+        const auto actualEnds   = partition_copy(par, c.begin(), c.end(), actual.begin(), actual2.begin(), is_odd);
+        assert(equal(expected.begin(), expectedEnds.first, actual.begin(), actualEnds.first));
+        assert(equal(expected2.begin(), expectedEnds.second, actual2.begin(), actualEnds.second));
+    }
+}
+
+template <template <class...> class Container>
+void test_case_unique_copy_parallel(const size_t testSize, mt19937& gen) {
+    vector<unsigned int> tmp(testSize);
+    vector<unsigned int> expected(testSize);
+    vector<unsigned int> actual(testSize);
+    uniform_int_distribution<unsigned int> dist(0, 29);
+    for (int i = 0; i < 10; ++i) {
+        // small values, so that runs of equivalent elements are common, and cross chunk boundaries
+        generate(tmp.begin(), tmp.end(), [&] { return dist(gen); });
+        sort(tmp.begin(), tmp.begin() + static_cast<ptrdiff_t>(testSize / 2));
+        const Container<unsigned int> c(tmp.begin(), tmp.end());
+
+        auto expectedEnd = unique_copy(tmp.begin(), tmp.end(), expected.begin());
+        auto actualEnd   = unique_copy(par, c.begin(), c.end(), actual.begin());
+        assert(equal(expected.begin(), expectedEnd, actual.begin(), actualEnd));
+
+        expectedEnd = unique_copy(tmp.begin(), tmp.end(), expected.begin(), same_tens);
+        actualEnd   = unique_copy(par, c.begin(), c.end(), actual.begin(), same_tens);
+        assert(equal(expected.begin(), expectedEnd, actual.begin(), actualEnd));
+    }
+
+    // everything equal:
+    fill(tmp.begin(), tmp.end(), 7U);
+    const Container<unsigned int> c(tmp.begin(), tmp.end());
+    const auto actualEnd = unique_copy(par, c.begin(), c.end(), actual.begin());
+    assert(actualEnd - actual.begin() == (testSize == 0 ? 0 : 1));
+}
+
+int main() {
+    mt19937 gen(1729);
+
+    parallel_test_case(test_case_copy_if_family_parallel<list>, gen);
+    parallel_test_case(test_case_copy_if_family_parallel<vector>, gen);
+    parallel_test_case(test_case_unique_copy_parallel<list>, gen);
+    parallel_test_case(test_case_unique_copy_parallel<vector>, gen);
+}
@@ -0,0 +1,121 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <forward_list>
+#include <list>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+using lcg64 = linear_congruential_engine<unsigned long long, 6364136223846793005ULL, 1442695040888963407ULL, 0>;
+
+// only engines that jump ahead in O(log n) may be split; the others would be no faster than serial generate()
+static_assert(stdext::has_fast_discard<minstd_rand>::value);
+static_assert(stdext::has_fast_discard<lcg64>::value);
+static_assert(!stdext::has_fast_discard<mt19937>::value);
+static_assert(!stdext::has_fast_discard<mt19937_64>::value);
+static_assert(!stdext::has_fast_discard<ranlux24>::value);
+static_assert(!stdext::has_fast_discard<knuth_b>::value);
+
+template <class Engine, template <class...> class Container>
+void test_case_generate_splittable(const size_t testSize) {
+    Engine serialEngine;
+    serialEngine.discard(5); // start somewhere other than the default seed's first output
+    Engine parallelEngine = serialEngine;
+
+    vector<typename Engine::result_type> expected(testSize);
+    generate(expected.begin(), expected.end(), ref(serialEngine));
+
+    Container<typename Engine::result_type> actual(testSize);
+    generate(par, actual.begin(), actual.end(), stdext::splittable_generator{parallelEngine});
+    assert(equal(actual.begin(), actual.end(), expected.begin(), expected.end()));
+    assert(parallelEngine == serialEngine);
+
+    generate(expected.begin(), expected.end(), ref(serialEngine));
+    auto result = generate_n(par, actual.begin(), testSize, stdext::splittable_generator{parallelEngine});
+    assert(result == actual.end());
+    assert(equal(actual.begin(), actual.end(), expected.begin(), expected.end()));
+    assert(parallelEngine == serialEngine);
+}
+
+template <template <class...> class Container>
+void test_case_generate_stateless(const size_t testSize) {
+    Container<int> actual(testSize);
+    generate(par, actual.begin(), actual.end(), stdext::stateless_generator{[] { return 1729; }});
+    assert(all_of(actual.begin(), actual.end(), [](int x) { return x == 1729; }));
+
+    auto result = generate_n(par, actual.begin(), testSize, stdext::stateless_generator{[] { return 42; }});
+    assert(result == actual.end());
+    assert(all_of(actual.begin(), actual.end(), [](int x) { return x == 42; }));
+}
+
+void test_case_generate_unwrapped_stays_serial(const size_t testSize) {
+    // generators that make no promises are still called in order
+    vector<size_t> actual(testSize);
+    size_t counter = 0;
+    generate(par, actual.begin(), actual.end(), [&counter] { return counter++; });
+    for (size_t idx = 0; idx < testSize; ++idx) {
+        assert(actual[idx] == idx);
+    }
+
+    counter = 0;
+    assert(generate_n(par, actual.begin(), testSize, [&counter] { return counter++; }) == actual.end());
+    for (size_t idx = 0; idx < testSize; ++idx) {
+        assert(actual[idx] == idx);
+    }
+}
+
+void test_engine_discard() {
+    // discard() skips ahead by whole refills and by repeated squaring; check it against calling the engine
+    for (const unsigned long long skip : {0ULL, 1ULL, 623ULL, 624ULL, 625ULL, 1247ULL, 1248ULL, 100'000ULL}) {
+        mt19937 skipped;
+        mt19937 called;
+        (void) skipped();
+        (void) called();
+        skipped.discard(skip);
+        for (unsigned long long idx = 0; idx < skip; ++idx) {
+            (void) called();
+        }
+
+        assert(skipped == called);
+        assert(skipped() == called());
+
+        minstd_rand skippedLcg;
+        minstd_rand calledLcg;
+        skippedLcg.discard(skip);
+        for (unsigned long long idx = 0; idx < skip; ++idx) {
+            (void) calledLcg();
+        }
+
+        assert(skippedLcg == calledLcg);
+
+        lcg64 skipped64;
+        auto called64 = skipped64;
+        skipped64.discard(skip);
+        for (unsigned long long idx = 0; idx < skip; ++idx) {
+            (void) called64();
+        }
+
+        assert(skipped64 == called64);
+    }
+}
+
+int main() {
+    test_engine_discard();
+
+    parallel_test_case(test_case_generate_splittable<minstd_rand, vector>);
+    parallel_test_case(test_case_generate_splittable<minstd_rand, list>);
+    parallel_test_case(test_case_generate_splittable<lcg64, vector>);
+    parallel_test_case(test_case_generate_splittable<lcg64, forward_list>);
+    parallel_test_case(test_case_generate_stateless<vector>);
+    parallel_test_case(test_case_generate_stateless<forward_list>);
+    parallel_test_case(test_case_generate_unwrapped_stays_serial);
+}
@@ -0,0 +1,84 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <execution>
+#include <functional>
+#include <list>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+const auto cmpTens = [](auto a, auto b) { return a / 10 < b / 10; };
+
+template <template <class...> class Container>
+void test_case_includes_parallel_special_cases() {
+    Container<int> input1;
+    Container<int> input2;
+    assert(includes(par, input1.begin(), input1.end(), input2.begin(), input2.end())); // both empty
+    input2.push_back(1);
+    assert(!includes(par, input1.begin(), input1.end(), input2.begin(), input2.end()));
+    input1.push_back(1);
+    assert(includes(par, input1.begin(), input1.end(), input2.begin(), input2.end()));
+    input2.push_back(1);
+    assert(!includes(par, input1.begin(), input1.end(), input2.begin(), input2.end())); // multiplicity matters
+    input1.assign({11, 15, 25});
+    input2.assign({10, 19, 20});
+    assert(includes(par, input1.begin(), input1.end(), input2.begin(), input2.end(), cmpTens));
+    input2.assign({10, 20, 21});
+    assert(!includes(par, input1.begin(), input1.end(), input2.begin(), input2.end(), cmpTens));
+    input1.assign({25, 15, 11});
+    input2.assign({25, 11});
+    assert(includes(par, input1.begin(), input1.end(), input2.begin(), input2.end(), greater{}));
+}
+
+template <template <class...> class Container>
+void test_case_includes_parallel(const size_t testSize, mt19937& gen) {
+    Container<size_t> input1;
+    for (size_t idx = 0; idx < testSize; ++idx) {
+        input1.push_back(idx / 2); // each element twice
+    }
+
+    // every other element of input1
+    Container<size_t> input2;
+    for (auto it = input1.begin(); it != input1.end(); ++it) {
+        if (++it == input1.end()) {
+            break;
+        }
+
+        input2.push_back(*it);
+    }
+
+    assert(includes(par, input1.begin(), input1.end(), input1.begin(), input1.end()));
+    assert(includes(par, input1.begin(), input1.end(), input2.begin(), input2.end()));
+    assert(includes(par, input2.begin(), input2.end(), input2.begin(), input2.end()));
+    assert(input1.size() < 2 || !includes(par, input2.begin(), input2.end(), input1.begin(), input1.end()));
+
+    if (testSize == 0) {
+        return;
+    }
+
+    // remove every copy of a random value from input1
+    const auto removedValue = uniform_int_distribution<size_t>{0, (testSize - 1) / 2}(gen);
+    input1.erase(remove(input1.begin(), input1.end(), removedValue), input1.end());
+    const bool expected = includes(input1.begin(), input1.end(), input2.begin(), input2.end());
+    assert(includes(par, input1.begin(), input1.end(), input2.begin(), input2.end()) == expected);
+
+    // add a value larger than any in input1
+    input2.push_back(testSize);
+    assert(!includes(par, input1.begin(), input1.end(), input2.begin(), input2.end()));
+}
+
+int main() {
+    mt19937 gen(1729);
+
+    test_case_includes_parallel_special_cases<list>();
+    test_case_includes_parallel_special_cases<vector>();
+    parallel_test_case(test_case_includes_parallel<list>, gen);
+    parallel_test_case(test_case_includes_parallel<vector>, gen);
+}
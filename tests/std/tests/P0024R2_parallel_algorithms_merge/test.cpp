@@ -0,0 +1,139 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <execution>
+#include <functional>
+#include <list>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+const auto cmpTens = [](auto a, auto b) { return a / 10 < b / 10; };
+
+vector<size_t> get_sorted_test_case_vector(const size_t testSize, const size_t tag, mt19937& gen) {
+    // elements are tagged in the ones digit with which input they came from, so that stability can be checked
+    uniform_int_distribution<size_t> dist(static_cast<size_t>(0), testSize);
+    vector<size_t> c;
+    for (size_t idx = 0; idx < testSize; ++idx) {
+        c.push_back(dist(gen) * 10 + tag);
+    }
+
+    sort(c.begin(), c.end());
+    return c;
+}
+
+template <class FwdIt>
+void assert_merge_cmpTens_test_case(FwdIt first, const FwdIt last) {
+    // equivalent elements from the first input (tagged 1) must precede those from the second input (tagged 2)
+    assert(is_sorted(first, last));
+}
+
+template <template <class...> class Container>
+void test_case_merge_parallel_special_cases() {
+    Container<int> input1;
+    Container<int> input2;
+    vector<int> result(4);
+    auto resultEnd = merge(par, input1.begin(), input1.end(), input2.begin(), input2.end(), result.begin());
+    assert(resultEnd == result.begin()); // both empty
+
+    input1.push_back(1);
+    resultEnd = merge(par, input1.begin(), input1.end(), input2.begin(), input2.end(), result.begin());
+    assert(resultEnd == result.begin() + 1);
+    assert(result[0] == 1);
+
+    input2.push_back(0);
+    resultEnd = merge(par, input1.begin(), input1.end(), input2.begin(), input2.end(), result.begin());
+    assert(resultEnd == result.begin() + 2);
+    assert(result[0] == 0 && result[1] == 1);
+
+    input1.assign({11, 25});
+    input2.assign({10, 20});
+    resultEnd = merge(par, input1.begin(), input1.end(), input2.begin(), input2.end(), result.begin(), cmpTens);
+    assert(resultEnd == result.end());
+    assert(result == vector<int>({11, 10, 25, 20}));
+
+    input1.assign({25, 11});
+    input2.assign({20, 10});
+    resultEnd = merge(par, input1.begin(), input1.end(), input2.begin(), input2.end(), result.begin(), greater{});
+    assert(resultEnd == result.end());
+    assert(result == vector<int>({25, 20, 11, 10}));
+}
+
+template <template <class...> class Container>
+void test_case_inplace_merge_parallel_special_cases() {
+    Container<int> testData;
+    inplace_merge(par, testData.begin(), testData.begin(), testData.end()); // empty range
+    testData.push_back(1);
+    inplace_merge(par, testData.begin(), testData.begin(), testData.end()); // 1 element
+    inplace_merge(par, testData.begin(), testData.end(), testData.end());
+    assert(testData == Container<int>({1}));
+    testData.push_back(0);
+    inplace_merge(par, testData.begin(), next(testData.begin()), testData.end());
+    assert(testData == Container<int>({0, 1}));
+    testData.assign({11, 25, 10, 20});
+    inplace_merge(par, testData.begin(), next(testData.begin(), 2), testData.end(), cmpTens);
+    assert(testData == Container<int>({11, 10, 25, 20}));
+}
+
+template <template <class...> class Container>
+void test_case_merge_parallel(const size_t testSize, mt19937& gen) {
+    const auto vec1 = get_sorted_test_case_vector(testSize, 1, gen);
+    const auto vec2 = get_sorted_test_case_vector(testSize / 2, 2, gen);
+    const Container<size_t> input1(vec1.begin(), vec1.end());
+    const Container<size_t> input2(vec2.begin(), vec2.end());
+    vector<size_t> expected(vec1.size() + vec2.size());
+    merge(vec1.begin(), vec1.end(), vec2.begin(), vec2.end(), expected.begin(), cmpTens);
+    assert_merge_cmpTens_test_case(expected.begin(), expected.end());
+
+    vector<size_t> result(expected.size());
+    auto resultEnd = merge(par, input1.begin(), input1.end(), input2.begin(), input2.end(), result.begin(), cmpTens);
+    assert(resultEnd == result.end());
+    assert(result == expected);
+
+    // swapping the inputs swaps which equivalent elements go first
+    merge(vec2.begin(), vec2.end(), vec1.begin(), vec1.end(), expected.begin(), cmpTens);
+    resultEnd = merge(par, input2.begin(), input2.end(), input1.begin(), input1.end(), result.begin(), cmpTens);
+    assert(resultEnd == result.end());
+    assert(result == expected);
+}
+
+template <template <class...> class Container>
+void test_case_inplace_merge_parallel(const size_t testSize, mt19937& gen) {
+    auto vec             = get_sorted_test_case_vector(testSize, 1, gen);
+    const auto vec2      = get_sorted_test_case_vector(testSize / 2, 2, gen);
+    const auto midOffset = static_cast<ptrdiff_t>(vec.size());
+    vec.insert(vec.end(), vec2.begin(), vec2.end());
+    vector<size_t> expected(vec);
+    inplace_merge(expected.begin(), expected.begin() + midOffset, expected.end(), cmpTens);
+    assert_merge_cmpTens_test_case(expected.begin(), expected.end());
+
+    Container<size_t> c(vec.begin(), vec.end());
+    inplace_merge(par, c.begin(), next(c.begin(), midOffset), c.end(), cmpTens);
+    assert(equal(c.begin(), c.end(), expected.begin(), expected.end()));
+
+    // exercise the no-predicate overload with the second half already entirely after the first
+    sort(vec.begin(), vec.end());
+    c.assign(vec.begin(), vec.end());
+    const auto cMid = next(c.begin(), static_cast<ptrdiff_t>(c.size() / 2));
+    inplace_merge(par, c.begin(), cMid, c.end());
+    assert(equal(c.begin(), c.end(), vec.begin(), vec.end()));
+}
+
+int main() {
+    mt19937 gen(1729);
+
+    test_case_merge_parallel_special_cases<list>();
+    test_case_merge_parallel_special_cases<vector>();
+    test_case_inplace_merge_parallel_special_cases<list>();
+    test_case_inplace_merge_parallel_special_cases<vector>();
+    parallel_test_case(test_case_merge_parallel<list>, gen);
+    parallel_test_case(test_case_merge_parallel<vector>, gen);
+    parallel_test_case(test_case_inplace_merge_parallel<list>, gen);
+    parallel_test_case(test_case_inplace_merge_parallel<vector>, gen);
+}
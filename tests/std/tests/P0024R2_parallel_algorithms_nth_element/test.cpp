@@ -0,0 +1,109 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// sizes large enough to take the parallel selection path:
+const size_t large_cases[] = {20000, 100003};
+
+void assert_permutation(const vector<unsigned int>& sorted, vector<unsigned int> actual) {
+    sort(actual.begin(), actual.end());
+    assert(actual == sorted);
+}
+
+void assert_nth_element(const vector<unsigned int>& sorted, const vector<unsigned int>& actual, const size_t nth) {
+    assert(actual[nth] == sorted[nth]);
+    assert(all_of(actual.begin(), actual.begin() + static_cast<ptrdiff_t>(nth),
+        [&](unsigned int val) { return val <= actual[nth]; }));
+    assert(all_of(actual.begin() + static_cast<ptrdiff_t>(nth), actual.end(),
+        [&](unsigned int val) { return val >= actual[nth]; }));
+    assert_permutation(sorted, actual);
+}
+
+void test_case_nth_element_parallel(const size_t testSize, mt19937& gen) {
+    for (const unsigned int maxVal : {5U, 0xFFFFFFFFU}) { // few distinct values, and mostly distinct values
+        uniform_int_distribution<unsigned int> dist(0, maxVal);
+        vector<unsigned int> source(testSize);
+        generate(source.begin(), source.end(), [&] { return dist(gen); });
+        vector<unsigned int> sorted(source);
+        sort(sorted.begin(), sorted.end());
+
+        nth_element(par, source.begin(), source.end(), source.end()); // nothing to do
+        if (testSize == 0) {
+            continue;
+        }
+
+        uniform_int_distribution<size_t> nthDist(0, testSize - 1);
+        for (const size_t nth : {size_t{0}, testSize / 2, testSize - 1, nthDist(gen)}) {
+            vector<unsigned int> actual(source);
+            nth_element(par, actual.begin(), actual.begin() + static_cast<ptrdiff_t>(nth), actual.end());
+            assert_nth_element(sorted, actual, nth);
+
+            actual = source;
+            nth_element(par, actual.begin(), actual.begin() + static_cast<ptrdiff_t>(nth), actual.end(), greater<>{});
+            reverse(actual.begin(), actual.end());
+            assert_nth_element(sorted, actual, testSize - 1 - nth);
+        }
+    }
+}
+
+template <class ExecutionPolicy>
+void test_partial_sort_with(const ExecutionPolicy& exec, const vector<unsigned int>& source,
+    const vector<unsigned int>& sorted, const size_t mid) {
+    const size_t testSize = source.size();
+    const auto midDiff    = static_cast<ptrdiff_t>(mid);
+    vector<unsigned int> actual(source);
+    partial_sort(exec, actual.begin(), actual.begin() + midDiff, actual.end());
+    assert(equal(actual.begin(), actual.begin() + midDiff, sorted.begin()));
+    assert_permutation(sorted, actual);
+
+    // destination shorter than, and at least as long as, the source
+    vector<unsigned int> dest(mid);
+    assert(partial_sort_copy(exec, source.begin(), source.end(), dest.begin(), dest.end()) == dest.end());
+    assert(equal(dest.begin(), dest.end(), sorted.begin(), sorted.begin() + midDiff));
+
+    dest.assign(testSize + 1, 0U);
+    assert(partial_sort_copy(exec, source.begin(), source.end(), dest.begin(), dest.end(), greater<>{})
+           == dest.begin() + static_cast<ptrdiff_t>(testSize));
+    assert(equal(dest.begin(), dest.end() - 1, sorted.rbegin(), sorted.rend()));
+}
+
+void test_case_partial_sort_parallel(const size_t testSize, mt19937& gen) {
+    uniform_int_distribution<unsigned int> dist(0, static_cast<unsigned int>(testSize));
+    vector<unsigned int> source(testSize);
+    generate(source.begin(), source.end(), [&] { return dist(gen); });
+    vector<unsigned int> sorted(source);
+    sort(sorted.begin(), sorted.end());
+
+    for (const size_t mid : {size_t{0}, size_t{1}, testSize / 3, testSize}) {
+        if (mid > testSize) {
+            continue;
+        }
+
+        // the final sort of the selected elements runs under the caller's policy
+        test_partial_sort_with(par, source, sorted, mid);
+        test_partial_sort_with(par_unseq, source, sorted, mid);
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+
+    parallel_test_case(test_case_nth_element_parallel, gen);
+    parallel_test_case(test_case_partial_sort_parallel, gen);
+    for (const size_t testSize : large_cases) {
+        test_case_nth_element_parallel(testSize, gen);
+        test_case_partial_sort_parallel(testSize, gen);
+    }
+}
@@ -58,9 +58,38 @@ void test_case_partition_parallel(const size_t testSize, mt19937& gen) {
     }
 }
 
+template <template <class...> class Container>
+void test_case_stable_partition_parallel(const size_t testSize, mt19937& gen) {
+    Container<unsigned int> tmp(testSize);
+    vector<unsigned int> expected(testSize);
+    for (int i = 0; i < 20; ++i) {
+        generate(tmp.begin(), tmp.end(), ref(gen));
+        copy(tmp.begin(), tmp.end(), expected.begin());
+        const auto expectedMid = stable_partition(expected.begin(), expected.end(), is_even);
+        const auto actualMid   = stable_partition(par, tmp.begin(), tmp.end(), is_even);
+        assert(distance(tmp.begin(), actualMid) == distance(expected.begin(), expectedMid));
+        assert(equal(tmp.begin(), tmp.end(), expected.begin(), expected.end()));
+    }
+}
+
+void test_case_stable_partition_parallel_strings(const size_t testSize, mt19937& gen) {
+    // elements that aren't trivially copyable, to exercise moving through and destroying the temporary buffer
+    const auto ends_even = [](const string& str) { return is_even(static_cast<unsigned int>(str.back())); };
+    vector<string> tmp(testSize);
+    generate(tmp.begin(), tmp.end(), [&] { return string(40, 'x') + to_string(gen()); });
+    auto expected          = tmp;
+    const auto expectedMid = stable_partition(expected.begin(), expected.end(), ends_even);
+    const auto actualMid   = stable_partition(par, tmp.begin(), tmp.end(), ends_even);
+    assert(actualMid - tmp.begin() == expectedMid - expected.begin());
+    assert(tmp == expected);
+}
+
 int main() {
     mt19937 gen(1729);
     parallel_test_case(test_case_partition_parallel<forward_list>, gen);
     parallel_test_case(test_case_partition_parallel<list>, gen);
     parallel_test_case(test_case_partition_parallel<vector>, gen);
+    parallel_test_case(test_case_stable_partition_parallel<list>, gen);
+    parallel_test_case(test_case_stable_partition_parallel<vector>, gen);
+    parallel_test_case(test_case_stable_partition_parallel_strings, gen);
 }
@@ -0,0 +1,102 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <execution>
+#include <functional>
+#include <list>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+const auto cmpTens = [](auto a, auto b) { return a / 10 < b / 10; };
+
+template <template <class...> class Container>
+void test_case_set_symmetric_difference_parallel_special_cases() {
+    Container<int> input1;
+    Container<int> input2;
+    vector<int> result(4);
+    auto resultEnd = set_symmetric_difference(
+        par, input1.begin(), input1.end(), input2.begin(), input2.end(), result.begin());
+    assert(resultEnd == result.begin()); // both empty
+
+    input1.push_back(1);
+    resultEnd = set_symmetric_difference(
+        par, input1.begin(), input1.end(), input2.begin(), input2.end(), result.begin());
+    assert(resultEnd == result.begin() + 1);
+    assert(result[0] == 1);
+
+    input2.push_back(1);
+    resultEnd = set_symmetric_difference(
+        par, input1.begin(), input1.end(), input2.begin(), input2.end(), result.begin());
+    assert(resultEnd == result.begin()); // equal ranges
+
+    // the last of equivalent elements remain, and are taken from the range that has more of them
+    input1.assign({11, 25, 26});
+    input2.assign({10, 20, 30});
+    resultEnd = set_symmetric_difference(
+        par, input1.begin(), input1.end(), input2.begin(), input2.end(), result.begin(), cmpTens);
+    assert(resultEnd == result.begin() + 2);
+    assert(result[0] == 26 && result[1] == 30);
+
+    input1.assign({25, 11});
+    input2.assign({20, 11});
+    resultEnd = set_symmetric_difference(
+        par, input1.begin(), input1.end(), input2.begin(), input2.end(), result.begin(), greater{});
+    assert(resultEnd == result.begin() + 2);
+    assert(result[0] == 25 && result[1] == 20);
+}
+
+vector<size_t> get_sorted_test_case_vector(const size_t testSize, const size_t tag, mt19937& gen) {
+    // elements are tagged in the ones digit with which input they came from, so the source of each result can be
+    // checked; the narrow range of keys produces many spans of equivalent elements
+    uniform_int_distribution<size_t> dist(static_cast<size_t>(0), testSize / 4);
+    vector<size_t> c;
+    for (size_t idx = 0; idx < testSize; ++idx) {
+        c.push_back(dist(gen) * 10 + tag);
+    }
+
+    sort(c.begin(), c.end());
+    return c;
+}
+
+template <template <class...> class Container>
+void test_case_set_symmetric_difference_parallel(const size_t testSize, mt19937& gen) {
+    const auto vec1 = get_sorted_test_case_vector(testSize, 1, gen);
+    const auto vec2 = get_sorted_test_case_vector(testSize / 2, 2, gen);
+    const Container<size_t> input1(vec1.begin(), vec1.end());
+    const Container<size_t> input2(vec2.begin(), vec2.end());
+    vector<size_t> expected(vec1.size() + vec2.size());
+    vector<size_t> result(expected.size());
+
+    auto expectedEnd = set_symmetric_difference(
+        vec1.begin(), vec1.end(), vec2.begin(), vec2.end(), expected.begin(), cmpTens);
+    auto resultEnd   = set_symmetric_difference(
+        par, input1.begin(), input1.end(), input2.begin(), input2.end(), result.begin(), cmpTens);
+    assert(equal(result.begin(), resultEnd, expected.begin(), expectedEnd));
+
+    expectedEnd = set_symmetric_difference(
+        vec2.begin(), vec2.end(), vec1.begin(), vec1.end(), expected.begin(), cmpTens);
+    resultEnd   = set_symmetric_difference(
+        par, input2.begin(), input2.end(), input1.begin(), input1.end(), result.begin(), cmpTens);
+    assert(equal(result.begin(), resultEnd, expected.begin(), expectedEnd));
+
+    expectedEnd = set_symmetric_difference(vec1.begin(), vec1.end(), vec1.begin(), vec1.end(), expected.begin());
+    resultEnd   = set_symmetric_difference(
+        par, input1.begin(), input1.end(), input1.begin(), input1.end(), result.begin());
+    assert(equal(result.begin(), resultEnd, expected.begin(), expectedEnd));
+}
+
+int main() {
+    mt19937 gen(1729);
+
+    test_case_set_symmetric_difference_parallel_special_cases<list>();
+    test_case_set_symmetric_difference_parallel_special_cases<vector>();
+    parallel_test_case(test_case_set_symmetric_difference_parallel<list>, gen);
+    parallel_test_case(test_case_set_symmetric_difference_parallel<vector>, gen);
+}
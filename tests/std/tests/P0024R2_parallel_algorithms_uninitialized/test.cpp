@@ -0,0 +1,125 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+template <class T>
+struct raw_storage {
+    allocator<T> alloc;
+    size_t size;
+    T* ptr;
+
+    explicit raw_storage(const size_t n) : size(n), ptr(alloc.allocate(n + 1)) {}
+    raw_storage(const raw_storage&)            = delete;
+    raw_storage& operator=(const raw_storage&) = delete;
+    ~raw_storage() {
+        alloc.deallocate(ptr, size + 1);
+    }
+
+    T* begin() const {
+        return ptr;
+    }
+
+    T* end() const {
+        return ptr + size;
+    }
+};
+
+template <class T>
+T make_value(mt19937& gen) {
+    if constexpr (is_same_v<T, string>) {
+        return string(30, 'x') + to_string(gen()); // not trivially copyable, and too long for the small string buffer
+    } else {
+        return static_cast<T>(gen());
+    }
+}
+
+template <class T, template <class...> class Container>
+void test_case_uninitialized_copy_move_parallel(const size_t testSize, mt19937& gen) {
+    vector<T> expected(testSize);
+    generate(expected.begin(), expected.end(), [&] { return make_value<T>(gen); });
+    Container<T> source(expected.begin(), expected.end());
+    const auto count = static_cast<ptrdiff_t>(testSize);
+
+    {
+        raw_storage<T> dest(testSize);
+        assert(uninitialized_copy(par, source.begin(), source.end(), dest.begin()) == dest.end());
+        assert(equal(dest.begin(), dest.end(), expected.begin(), expected.end()));
+        destroy(par, dest.begin(), dest.end());
+    }
+
+    {
+        raw_storage<T> dest(testSize);
+        assert(uninitialized_copy_n(par, source.begin(), count, dest.begin()) == dest.end());
+        assert(equal(dest.begin(), dest.end(), expected.begin(), expected.end()));
+        destroy_n(par, dest.begin(), count);
+    }
+
+    {
+        raw_storage<T> dest(testSize);
+        assert(uninitialized_move(par, source.begin(), source.end(), dest.begin()) == dest.end());
+        assert(equal(dest.begin(), dest.end(), expected.begin(), expected.end()));
+        destroy(par, dest.begin(), dest.end());
+    }
+
+    source.assign(expected.begin(), expected.end());
+    {
+        raw_storage<T> dest(testSize);
+        const auto result = uninitialized_move_n(par, source.begin(), count, dest.begin());
+        assert(result.first == source.end());
+        assert(result.second == dest.end());
+        assert(equal(dest.begin(), dest.end(), expected.begin(), expected.end()));
+        destroy(par, dest.begin(), dest.end());
+    }
+
+    // nonpositive counts do nothing
+    assert(uninitialized_copy_n(par, source.begin(), 0, static_cast<T*>(nullptr)) == nullptr);
+    assert(uninitialized_move_n(par, source.begin(), -1, static_cast<T*>(nullptr)).first == source.begin());
+}
+
+template <class T>
+void test_case_uninitialized_fill_parallel(const size_t testSize, mt19937& gen) {
+    for (const T& val : {T{}, make_value<T>(gen)}) { // zeroes may take a different path
+        {
+            raw_storage<T> dest(testSize);
+            uninitialized_fill(par, dest.begin(), dest.end(), val);
+            assert(all_of(dest.begin(), dest.end(), [&](const T& elem) { return elem == val; }));
+            destroy(par, dest.begin(), dest.end());
+        }
+
+        {
+            raw_storage<T> dest(testSize);
+            assert(uninitialized_fill_n(par, dest.begin(), static_cast<ptrdiff_t>(testSize), val) == dest.end());
+            assert(all_of(dest.begin(), dest.end(), [&](const T& elem) { return elem == val; }));
+            destroy(par, dest.begin(), dest.end());
+        }
+    }
+
+    assert(uninitialized_fill_n(par, static_cast<T*>(nullptr), 0, T{}) == nullptr);
+}
+
+int main() {
+    mt19937 gen(1729);
+
+    parallel_test_case(test_case_uninitialized_copy_move_parallel<int, vector>, gen);
+    parallel_test_case(test_case_uninitialized_copy_move_parallel<int, list>, gen);
+    parallel_test_case(test_case_uninitialized_copy_move_parallel<string, vector>, gen);
+    parallel_test_case(test_case_uninitialized_copy_move_parallel<string, list>, gen);
+    parallel_test_case(test_case_uninitialized_fill_parallel<unsigned char>, gen);
+    parallel_test_case(test_case_uninitialized_fill_parallel<int>, gen);
+    parallel_test_case(test_case_uninitialized_fill_parallel<string>, gen);
+}
@@ -21,6 +21,7 @@
 #include <regex>
 #include <set>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
@@ -1457,6 +1458,72 @@ namespace {
                 test_is_equal<std::pmr::synchronized_pool_resource>();
             }
         } // namespace is_equal
+
+        namespace synchronized {
+            void test_threads() {
+                // blocks are allocated on one thread and deallocated on another
+                constexpr int thread_count = 8;
+                constexpr auto block_count = 1000_zu;
+                std::pmr::synchronized_pool_resource spr;
+                std::vector<std::vector<unsigned char*>> blocks(thread_count);
+
+                auto const size_of = [](std::size_t const i) { return 8_zu << (i % 8); };
+
+                auto const run = [&](auto const& fn) {
+                    std::vector<std::thread> threads;
+                    for (int t = 0; t < thread_count; ++t) {
+                        threads.emplace_back(fn, t);
+                    }
+                    for (auto& thread : threads) {
+                        thread.join();
+                    }
+                };
+
+                run([&](int const t) {
+                    for (auto i = 0_zu; i < block_count; ++i) {
+                        auto const ptr = static_cast<unsigned char*>(spr.allocate(size_of(i), alignof(void*)));
+                        std::fill_n(ptr, size_of(i), static_cast<unsigned char>(t));
+                        blocks[static_cast<std::size_t>(t)].push_back(ptr);
+                    }
+                });
+
+                run([&](int const t) {
+                    auto& theirs = blocks[static_cast<std::size_t>((t + 1) % thread_count)];
+                    auto const tag = static_cast<unsigned char>((t + 1) % thread_count);
+                    for (auto i = 0_zu; i < block_count; ++i) {
+                        auto const is_tag = [tag](unsigned char const c) { return c == tag; };
+                        CHECK(std::all_of(theirs[i], theirs[i] + size_of(i), is_tag));
+                        spr.deallocate(theirs[i], size_of(i), alignof(void*));
+                    }
+                    theirs.clear();
+                });
+            }
+
+            void test_release() {
+                // cached blocks are discarded by release, and everything is returned upstream on destruction
+                recording_resource rr;
+                {
+                    std::pmr::synchronized_pool_resource spr{&rr};
+                    std::vector<void*> ptrs;
+                    for (auto i = 0_zu; i < 100; ++i) {
+                        ptrs.push_back(spr.allocate(sizeof(void*), alignof(void*)));
+                    }
+                    for (auto const ptr : ptrs) {
+                        spr.deallocate(ptr, sizeof(void*), alignof(void*));
+                    }
+
+                    spr.release();
+                    void* const ptr = spr.allocate(sizeof(void*), alignof(void*));
+                    spr.deallocate(ptr, sizeof(void*), alignof(void*));
+                }
+                CHECK(rr.allocations_.empty());
+            }
+
+            void test() {
+                test_threads();
+                test_release();
+            }
+        } // namespace synchronized
     } // namespace pool
 
     namespace containers {
@@ -1596,6 +1663,7 @@ int main() {
     pool::options::test();
     pool::is_equal::test();
     pool::allocate_deallocate::test();
+    pool::synchronized::test();
 
     containers::test();
 
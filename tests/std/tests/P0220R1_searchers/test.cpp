@@ -6,6 +6,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <forward_list>
 #include <functional>
 #include <initializer_list>
@@ -323,6 +324,29 @@ void test_case_BM_unicode() {
     assert(slowFast.first == fastHaystack.end());
     assert(slowFast.second == fastHaystack.end());
     assert_equal(slowSlow, slowHaystack.begin(), 149, static_cast<ptrdiff_t>(slowPattern.size()));
+
+    // A short contiguous pattern may skip building the big table in favor of a plain search; haystacks that
+    // search can't take build the tables on first use, and share them with copies of the searcher.
+    const deque<char16_t> slowHaystackDeque(slowHaystack.begin(), slowHaystack.end());
+    const auto slowDeque = slowPatBM(slowHaystackDeque.begin(), slowHaystackDeque.end());
+    assert_equal(slowDeque, slowHaystackDeque.begin(), 149, static_cast<ptrdiff_t>(slowPattern.size()));
+    const auto slowDequeAgain = slowPatBM(slowHaystackDeque.begin(), slowHaystackDeque.end());
+    assert(slowDequeAgain == slowDeque);
+    const BM slowPatBMCopy(slowPatBM);
+    assert(slowPatBMCopy(slowHaystackDeque.begin(), slowHaystackDeque.end()) == slowDeque);
+    assert(slowPatBMCopy(slowHaystack.begin(), slowHaystack.end()) == slowSlow);
+
+    // long patterns always build the big table
+    const u16string longPatternStr    = u"\U0001F3C8" + u16string(100, u'a') + u"\U0001F3C8";
+    const u16string longHaystackStr   = u16string(500, u'a') + longPatternStr + u16string(500, u'a');
+    const u16string_view longPattern  = longPatternStr;
+    const u16string_view longHaystack = longHaystackStr;
+    const BM longPatBM(longPattern.begin(), longPattern.end());
+    assert_equal(longPatBM(longHaystack.begin(), longHaystack.end()), longHaystack.begin(), 500,
+        static_cast<ptrdiff_t>(longPattern.size()));
+    const deque<char16_t> longHaystackDeque(longHaystack.begin(), longHaystack.end());
+    assert_equal(longPatBM(longHaystackDeque.begin(), longHaystackDeque.end()), longHaystackDeque.begin(), 500,
+        static_cast<ptrdiff_t>(longPattern.size()));
 }
 
 template <template <class RanIt, class Hash, class Pred_eq> class Searcher>
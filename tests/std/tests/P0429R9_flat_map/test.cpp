@@ -0,0 +1,314 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <deque>
+#include <flat_map>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory_resource>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+template <class FlatMap, class Map>
+void assert_same(const FlatMap& actual, const Map& expected) {
+    assert(actual.size() == expected.size());
+    assert(actual.keys().size() == actual.values().size());
+    auto it = expected.begin();
+    for (const auto& [key, val] : actual) {
+        assert(key == it->first);
+        assert(val == it->second);
+        ++it;
+    }
+}
+
+template <class FlatMap, class Map>
+void test_against_map(const unsigned int seed) {
+    constexpr bool multi = is_same_v<Map, multimap<int, string>>;
+    using elements       = vector<pair<int, string>>;
+
+    mt19937 gen(seed);
+    FlatMap actual;
+    Map expected;
+
+    const auto random_elements = [&gen] {
+        elements elems(gen() % 20);
+        for (auto& elem : elems) {
+            elem = {static_cast<int>(gen() % 200), to_string(gen() % 100)};
+        }
+        return elems;
+    };
+    const auto key_less = [](const pair<int, string>& lhs, const pair<int, string>& rhs) {
+        return lhs.first < rhs.first;
+    };
+    const auto key_equal = [](const pair<int, string>& lhs, const pair<int, string>& rhs) {
+        return lhs.first == rhs.first;
+    };
+
+    for (int op = 0; op < 30000; ++op) {
+        const int key    = static_cast<int>(gen() % 200);
+        const string val = to_string(gen() % 1000);
+        switch (gen() % 10) {
+        case 0:
+            actual.emplace(key, val);
+            expected.emplace(key, val);
+            break;
+        case 1:
+            actual.insert(pair<int, string>{key, val});
+            expected.insert(pair<int, string>{key, val});
+            break;
+        case 2:
+            if constexpr (multi) {
+                actual.emplace_hint(actual.upper_bound(key), key, val);
+            } else {
+                const auto offset = static_cast<ptrdiff_t>(gen() % (actual.size() + 1));
+                assert(actual.emplace_hint(actual.begin() + offset, key, val)->first == key);
+            }
+            expected.emplace(key, val);
+            break;
+        case 3:
+            assert(actual.erase(key) == expected.erase(key));
+            break;
+        case 4:
+            assert(actual.count(key) == expected.count(key));
+            assert(actual.contains(key) == expected.contains(key));
+            break;
+        case 5:
+            {
+                assert(distance(actual.begin(), actual.lower_bound(key))
+                       == distance(expected.begin(), expected.lower_bound(key)));
+                assert(distance(actual.begin(), actual.upper_bound(key))
+                       == distance(expected.begin(), expected.upper_bound(key)));
+                const auto [first, last] = actual.equal_range(key);
+                assert(static_cast<size_t>(last - first) == expected.count(key));
+                break;
+            }
+        case 6:
+            {
+                auto elems = random_elements();
+                if constexpr (!multi) {
+                    // which of several equivalent new elements is kept is unspecified, so avoid them
+                    stable_sort(elems.begin(), elems.end(), key_less);
+                    elems.erase(unique(elems.begin(), elems.end(), key_equal), elems.end());
+                    shuffle(elems.begin(), elems.end(), gen);
+                }
+                actual.insert(elems.begin(), elems.end());
+                expected.insert(elems.begin(), elems.end());
+                break;
+            }
+        case 7:
+            {
+                auto elems = random_elements();
+                stable_sort(elems.begin(), elems.end(), key_less);
+                if constexpr (multi) {
+                    actual.insert(sorted_equivalent, elems.begin(), elems.end());
+                } else {
+                    elems.erase(unique(elems.begin(), elems.end(), key_equal), elems.end());
+                    actual.insert(sorted_unique, elems.begin(), elems.end());
+                }
+                expected.insert(elems.begin(), elems.end());
+                break;
+            }
+        case 8:
+            {
+                const auto it = actual.find(key);
+                if (it != actual.end()) {
+                    const auto expected_it = expected.find(key);
+                    assert(it->second == expected_it->second);
+                    actual.erase(it);
+                    expected.erase(expected_it);
+                }
+                break;
+            }
+        case 9:
+            if constexpr (multi) {
+                actual.insert_range(elements{{key, val}, {key, val}});
+                expected.emplace(key, val);
+                expected.emplace(key, val);
+            } else {
+                switch (gen() % 3) {
+                case 0:
+                    actual[key]   = val;
+                    expected[key] = val;
+                    break;
+                case 1:
+                    assert(actual.try_emplace(key, val).second == expected.try_emplace(key, val).second);
+                    break;
+                case 2:
+                    assert(actual.insert_or_assign(key, val).second == expected.insert_or_assign(key, val).second);
+                    break;
+                }
+            }
+            break;
+        }
+    }
+
+    assert_same(actual, expected);
+
+    auto copied = actual;
+    assert(copied == actual);
+    auto moved = move(copied);
+    assert(copied.empty());
+    assert(moved == actual);
+
+    const auto pred = [](const auto& elem) { return elem.first % 3 == 0; };
+    assert(erase_if(actual, pred) == erase_if(expected, pred));
+    assert_same(actual, expected);
+
+    auto cont = move(actual).extract();
+    assert(actual.empty());
+    actual.replace(move(cont.keys), move(cont.values));
+    assert_same(actual, expected);
+}
+
+struct string_less {
+    using is_transparent = int;
+
+    bool operator()(const string& lhs, const string& rhs) const {
+        return lhs < rhs;
+    }
+    bool operator()(const string& lhs, const char* const rhs) const {
+        return lhs < rhs;
+    }
+    bool operator()(const char* const lhs, const string& rhs) const {
+        return lhs < rhs;
+    }
+};
+
+void test_map_interface() {
+    flat_map<int, int> m{{5, 1}, {3, 2}, {5, 3}};
+    assert(m.size() == 2);
+    assert(m.at(5) == 1); // the first of several equivalent elements is kept
+    assert(m[3] == 2);
+
+    try {
+        (void) m.at(9);
+        assert(false);
+    } catch (const out_of_range&) {
+    }
+
+    m.begin()->second = 42;
+    assert(m[3] == 42);
+
+    flat_map<int, int>::const_iterator it = m.begin();
+    assert(it->second == 42);
+    static_assert(random_access_iterator<flat_map<int, int>::iterator>);
+    static_assert(random_access_iterator<flat_map<int, int>::const_iterator>);
+
+    const auto comp = m.value_comp();
+    assert(comp(*m.begin(), *(m.begin() + 1)));
+
+    m = {{7, 8}};
+    assert(m.size() == 1);
+    assert(m.at(7) == 8);
+}
+
+void test_constructors() {
+    flat_map<int, int> m(vector<int>{9, 1, 9}, vector<int>{1, 2, 3});
+    assert((m.keys() == vector<int>{1, 9}));
+    assert((m.values() == vector<int>{2, 1}));
+
+    flat_multimap<int, int> mm(vector<int>{9, 1, 9}, vector<int>{1, 2, 3});
+    assert((mm.keys() == vector<int>{1, 9, 9}));
+    assert((mm.values() == vector<int>{2, 1, 3}));
+
+    flat_map<int, int> presorted(sorted_unique, vector<int>{1, 2}, vector<int>{3, 4});
+    assert(presorted.at(2) == 4);
+
+    flat_map<int, int, greater<int>> descending({{1, 1}, {2, 2}});
+    assert(descending.begin()->first == 2);
+
+    flat_map<int, int> from_rng(from_range, vector<pair<int, int>>{{4, 1}, {4, 2}, {2, 3}});
+    assert(from_rng.size() == 2);
+
+    swap(m, from_rng);
+    assert(m.at(4) == 1);
+
+    from_rng.swap(m);
+    assert(m.at(9) == 1);
+    mm.swap(mm);
+    assert(mm.size() == 3);
+
+    static_assert(
+        is_same_v<decltype(&flat_map<int, int>::swap), void (flat_map<int, int>::*)(flat_map<int, int>&) noexcept>);
+    static_assert(is_same_v<decltype(&flat_multimap<int, int>::swap),
+        void (flat_multimap<int, int>::*)(flat_multimap<int, int>&) noexcept>);
+}
+
+void test_deduction_guides() {
+    flat_map m1(vector<int>{1, 2}, vector<double>{1, 2});
+    static_assert(is_same_v<decltype(m1), flat_map<int, double>>);
+
+    flat_map m2{pair{1, 2.0}};
+    static_assert(is_same_v<decltype(m2), flat_map<int, double>>);
+
+    vector<pair<long, int>> elems{{1, 2}};
+    flat_map m3(elems.begin(), elems.end());
+    static_assert(is_same_v<decltype(m3), flat_map<long, int>>);
+
+    flat_multimap m4(sorted_equivalent, deque<int>{1, 1}, deque<int>{1, 2});
+    static_assert(is_same_v<decltype(m4), flat_multimap<int, int, less<int>, deque<int>, deque<int>>>);
+
+    flat_map m5(from_range, elems);
+    static_assert(is_same_v<decltype(m5), flat_map<long, int>>);
+}
+
+void test_allocators() {
+    using pmr_map = flat_map<int, int, less<int>, pmr::vector<int>, pmr::vector<int>>;
+    static_assert(uses_allocator_v<pmr_map, pmr::polymorphic_allocator<int>>);
+
+    pmr::monotonic_buffer_resource mr;
+    const pmr::polymorphic_allocator<int> alloc(&mr);
+
+    pmr_map p1(alloc);
+    p1.insert({{3, 1}, {2, 2}});
+    pmr_map p2(p1, alloc);
+    assert(p2 == p1);
+    assert(p2.keys().get_allocator().resource() == &mr);
+    assert(p2.values().get_allocator().resource() == &mr);
+
+    pmr_map p3({{5, 4}}, alloc);
+    assert(p3.size() == 1);
+}
+
+void test_heterogeneous_lookup() {
+    flat_map<string, int, string_less> m{{"b", 1}, {"a", 2}};
+    assert(m.contains("a"));
+    assert(m.find("b")->second == 1);
+    assert(m.count("z") == 0);
+    assert(m.at("a") == 2);
+    m["c"] = 3;
+    assert(!m.try_emplace("c", 9).second);
+    assert(m.erase("a") == 1);
+    assert(m.size() == 2);
+}
+
+void test_comparisons() {
+    assert((flat_map<int, int>{{1, 2}} < flat_map<int, int>{{1, 3}}));
+    assert((flat_map<int, int>{{1, 2}} <=> flat_map<int, int>{{1, 2}}) == 0);
+    assert((flat_multimap<int, int>{{1, 2}, {1, 2}} != flat_multimap<int, int>{{1, 2}}));
+}
+
+int main() {
+    test_against_map<flat_map<int, string>, map<int, string>>(1);
+    test_against_map<flat_multimap<int, string>, multimap<int, string>>(2);
+    test_against_map<flat_map<int, string, less<int>, deque<int>, deque<string>>, map<int, string>>(3);
+    test_against_map<flat_multimap<int, string, less<int>, deque<int>>, multimap<int, string>>(4);
+
+    test_map_interface();
+    test_constructors();
+    test_deduction_guides();
+    test_allocators();
+    test_heterogeneous_lookup();
+    test_comparisons();
+}
@@ -0,0 +1,363 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <inplace_vector>
+#include <iterator>
+#include <new>
+#include <random>
+#include <ranges>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+static_assert(is_trivially_copyable_v<inplace_vector<int, 8>>);
+static_assert(is_trivially_copyable_v<inplace_vector<string, 0>>);
+static_assert(is_trivially_destructible_v<inplace_vector<int, 8>>);
+static_assert(!is_trivially_copyable_v<inplace_vector<string, 8>>);
+static_assert(!is_trivially_destructible_v<inplace_vector<string, 8>>);
+static_assert(sizeof(inplace_vector<char, 15>) == 16); // the size counter is as narrow as the capacity allows
+static_assert(contiguous_iterator<inplace_vector<int, 8>::iterator>);
+static_assert(contiguous_iterator<inplace_vector<int, 8>::const_iterator>);
+static_assert(ranges::contiguous_range<inplace_vector<string, 8>>);
+static_assert(inplace_vector<int, 8>::capacity() == 8);
+static_assert(inplace_vector<int, 8>::max_size() == 8);
+
+int g_live_objects = 0;
+
+struct counted { // tracks the number of live objects, to catch leaked or doubly destroyed elements
+    int val;
+
+    counted(const int v = 0) : val(v) {
+        ++g_live_objects;
+    }
+    counted(const counted& other) : val(other.val) {
+        ++g_live_objects;
+    }
+    counted& operator=(const counted&) = default;
+    ~counted() {
+        --g_live_objects;
+    }
+
+    friend bool operator==(const counted&, const counted&) = default;
+};
+
+template <class T>
+T make_value(mt19937& gen) {
+    if constexpr (is_same_v<T, string>) {
+        return to_string(gen() % 1000) + "-padding-to-defeat-the-small-string-optimization";
+    } else {
+        return T(static_cast<int>(gen() % 1000));
+    }
+}
+
+template <class T>
+void test_against_vector(const unsigned int seed) {
+    constexpr size_t cap = 40;
+    mt19937 gen(seed);
+    inplace_vector<T, cap> actual;
+    vector<T> expected;
+
+    for (int op = 0; op < 20000; ++op) {
+        const T val = make_value<T>(gen);
+        switch (gen() % 12) {
+        case 0:
+            if (expected.size() < cap) {
+                actual.push_back(val);
+                expected.push_back(val);
+            } else {
+                try {
+                    actual.push_back(val);
+                    assert(false);
+                } catch (const bad_alloc&) {
+                }
+            }
+            break;
+        case 1:
+            {
+                T* const ptr = actual.try_push_back(val);
+                if (expected.size() < cap) {
+                    assert(ptr == &actual.back());
+                    expected.push_back(val);
+                } else {
+                    assert(ptr == nullptr);
+                }
+                break;
+            }
+        case 2:
+            if (expected.size() < cap) {
+                assert(&actual.unchecked_emplace_back(val) == &actual.back());
+                expected.push_back(val);
+            }
+            break;
+        case 3:
+            if (!expected.empty()) {
+                actual.pop_back();
+                expected.pop_back();
+            }
+            break;
+        case 4:
+            {
+                const auto off   = static_cast<ptrdiff_t>(gen() % (expected.size() + 1));
+                const auto count = gen() % 4;
+                if (expected.size() + count <= cap) {
+                    const auto it = actual.insert(actual.begin() + off, count, val);
+                    assert(it == actual.begin() + off);
+                    expected.insert(expected.begin() + off, count, val);
+                }
+                break;
+            }
+        case 5:
+            {
+                const auto off = static_cast<ptrdiff_t>(gen() % (expected.size() + 1));
+                vector<T> elems(gen() % 5, val);
+                if (expected.size() + elems.size() <= cap) {
+                    actual.insert(actual.begin() + off, elems.begin(), elems.end());
+                    expected.insert(expected.begin() + off, elems.begin(), elems.end());
+                } else {
+                    const auto before = actual;
+                    try {
+                        actual.insert_range(actual.begin() + off, elems);
+                        assert(false);
+                    } catch (const bad_alloc&) {
+                    }
+                    assert(actual == before);
+                }
+                break;
+            }
+        case 6:
+            if (!expected.empty()) {
+                const auto off = static_cast<ptrdiff_t>(gen() % expected.size());
+                const auto it  = actual.erase(actual.begin() + off);
+                assert(it == actual.begin() + off);
+                expected.erase(expected.begin() + off);
+            }
+            break;
+        case 7:
+            if (!expected.empty()) {
+                const auto first = static_cast<ptrdiff_t>(gen() % expected.size());
+                const auto count = static_cast<ptrdiff_t>(gen() % (expected.size() - static_cast<size_t>(first) + 1));
+                actual.erase(actual.begin() + first, actual.begin() + first + count);
+                expected.erase(expected.begin() + first, expected.begin() + first + count);
+            }
+            break;
+        case 8:
+            {
+                const auto new_size = gen() % (cap + 1);
+                actual.resize(new_size, val);
+                expected.resize(new_size, val);
+                break;
+            }
+        case 9:
+            {
+                vector<T> elems(gen() % 8, val);
+                const auto rest = actual.try_append_range(elems);
+                const auto fit  = (min) (elems.size(), cap - expected.size());
+                assert(rest == elems.begin() + static_cast<ptrdiff_t>(fit));
+                expected.insert(expected.end(), elems.begin(), rest);
+                break;
+            }
+        case 10:
+            {
+                const auto off = static_cast<ptrdiff_t>(gen() % (expected.size() + 1));
+                if (expected.size() < cap) {
+                    actual.emplace(actual.begin() + off, val);
+                    expected.emplace(expected.begin() + off, val);
+                }
+                break;
+            }
+        case 11:
+            {
+                vector<T> elems(gen() % (cap + 1), val);
+                actual.assign(elems.begin(), elems.end());
+                expected.assign(elems.begin(), elems.end());
+                break;
+            }
+        }
+
+        assert(actual.size() == expected.size());
+    }
+
+    assert(ranges::equal(actual, expected));
+    assert(ranges::equal(actual | views::reverse, expected | views::reverse));
+
+    auto copied = actual;
+    assert(copied == actual);
+    auto moved = move(copied);
+    assert(moved == actual);
+
+    inplace_vector<T, cap> other(2, make_value<T>(gen));
+    other.swap(moved);
+    assert(other == actual);
+    assert(moved.size() == 2);
+    swap(other, moved);
+    assert(moved == actual);
+    assert(other.size() == 2);
+
+    other = actual;
+    assert(other == actual);
+    other = move(moved);
+    assert(other == actual);
+}
+
+void test_hot_paths() {
+    inplace_vector<int, 3> v;
+    assert(v.empty());
+    int* const first = v.try_push_back(10);
+    assert(first == v.data());
+    assert(*first == 10);
+    v.unchecked_push_back(20);
+    assert(v.push_back(30) == 30);
+    assert(v.size() == 3);
+    assert(v.try_push_back(40) == nullptr);
+    assert(v.try_emplace_back(40) == nullptr);
+    assert(v.size() == 3);
+
+    try {
+        v.emplace_back(40);
+        assert(false);
+    } catch (const bad_alloc&) {
+    }
+    assert((v == inplace_vector<int, 3>{10, 20, 30}));
+
+    try {
+        (void) v.at(3);
+        assert(false);
+    } catch (const out_of_range&) {
+    }
+
+    try {
+        v.reserve(4);
+        assert(false);
+    } catch (const bad_alloc&) {
+    }
+    v.reserve(3);
+    v.shrink_to_fit();
+
+    try {
+        inplace_vector<int, 3> too_big(4);
+        assert(false);
+    } catch (const bad_alloc&) {
+    }
+}
+
+void test_zero_capacity() {
+    inplace_vector<string, 0> v;
+    assert(v.empty());
+    assert(v.begin() == v.end());
+    assert(v.try_push_back("meow") == nullptr);
+
+    try {
+        v.push_back("meow");
+        assert(false);
+    } catch (const bad_alloc&) {
+    }
+}
+
+void test_lifetimes() {
+    {
+        inplace_vector<counted, 10> v(4, counted{7});
+        assert(g_live_objects == 4);
+        v.insert(v.begin() + 1, {1, 2, 3});
+        assert(g_live_objects == 7);
+        v.erase(v.begin(), v.begin() + 2);
+        assert(g_live_objects == 5);
+
+        auto copy = v;
+        assert(g_live_objects == 10);
+        copy.resize(1);
+        assert(g_live_objects == 6);
+        copy = v;
+        assert(g_live_objects == 10);
+        v.clear();
+        assert(g_live_objects == 5);
+        v.swap(copy);
+        assert(g_live_objects == 5);
+        assert(v.size() == 5 && copy.empty());
+    }
+    assert(g_live_objects == 0);
+
+    {
+        // an input range that doesn't fit is inserted partly, then rolled back
+        inplace_vector<counted, 4> v{1, 2};
+        istringstream stream{"3 4 5"};
+        try {
+            v.insert(v.begin(), istream_iterator<int>{stream}, istream_iterator<int>{});
+            assert(false);
+        } catch (const bad_alloc&) {
+        }
+        assert((v == inplace_vector<counted, 4>{1, 2}));
+        assert(g_live_objects == 2);
+    }
+    assert(g_live_objects == 0);
+}
+
+void test_interface() {
+    inplace_vector<int, 10> v{3, 1, 4, 1, 5, 9, 2, 6};
+    assert(erase(v, 1) == 2);
+    assert((v == inplace_vector<int, 10>{3, 4, 5, 9, 2, 6}));
+    assert(erase_if(v, [](const int x) { return x % 2 == 0; }) == 3);
+    assert((v == inplace_vector<int, 10>{3, 5, 9}));
+
+    assert((inplace_vector<int, 4>{1, 2} < inplace_vector<int, 4>{1, 3}));
+    assert((inplace_vector<int, 4>{1, 2} <=> inplace_vector<int, 4>{1, 2}) == strong_ordering::equal);
+    assert((inplace_vector<int, 4>{1} != inplace_vector<int, 4>{1, 1}));
+
+    inplace_vector<int, 10> from_rng(from_range, views::iota(0, 5));
+    assert(from_rng.size() == 5);
+    from_rng.append_range(views::iota(5, 10));
+    assert(from_rng.back() == 9);
+    assert(from_rng.front() == 0);
+    from_rng.assign_range(views::iota(0, 2));
+    assert((from_rng == inplace_vector<int, 10>{0, 1}));
+    from_rng.assign(3, 7);
+    assert((from_rng == inplace_vector<int, 10>{7, 7, 7}));
+    from_rng = {4, 2};
+    assert(from_rng[1] == 2);
+
+    inplace_vector<int, 10>::const_iterator cit = from_rng.begin();
+    assert(*cit == 4);
+    assert(cit + 2 == from_rng.cend());
+    assert(to_address(from_rng.end()) == from_rng.data() + 2);
+}
+
+constexpr bool test_constexpr() {
+    inplace_vector<int, 6> v;
+    v.push_back(1);
+    v.unchecked_push_back(2);
+    (void) v.try_push_back(3);
+    v.insert(v.begin(), 0);
+    v.erase(v.begin() + 1);
+    assert((v == inplace_vector<int, 6>{0, 2, 3}));
+
+    auto copy = v;
+    copy.resize(5);
+    assert(copy.back() == 0);
+    assert(copy > v);
+    copy.swap(v);
+    assert(v.size() == 5 && copy.size() == 3);
+    return true;
+}
+
+static_assert(test_constexpr());
+
+int main() {
+    test_against_vector<int>(1);
+    test_against_vector<string>(2);
+    test_against_vector<counted>(3);
+    assert(g_live_objects == 0);
+
+    test_hot_paths();
+    test_zero_capacity();
+    test_lifetimes();
+    test_interface();
+    assert(test_constexpr());
+}
@@ -0,0 +1,240 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <deque>
+#include <flat_set>
+#include <functional>
+#include <iterator>
+#include <memory_resource>
+#include <random>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+template <class FlatSet, class Set>
+void assert_same(const FlatSet& actual, const Set& expected) {
+    assert(actual.size() == expected.size());
+    assert(equal(actual.begin(), actual.end(), expected.begin(), expected.end()));
+}
+
+template <class FlatSet, class Set>
+void test_against_set(const unsigned int seed) {
+    constexpr bool multi = is_same_v<Set, multiset<int>>;
+
+    mt19937 gen(seed);
+    FlatSet actual;
+    Set expected;
+
+    const auto random_keys = [&gen] {
+        vector<int> keys(gen() % 20);
+        for (auto& key : keys) {
+            key = static_cast<int>(gen() % 200);
+        }
+        return keys;
+    };
+
+    for (int op = 0; op < 30000; ++op) {
+        const int key = static_cast<int>(gen() % 200);
+        switch (gen() % 9) {
+        case 0:
+        case 1:
+            actual.insert(key);
+            expected.insert(key);
+            break;
+        case 2:
+            {
+                const auto offset = static_cast<ptrdiff_t>(gen() % (actual.size() + 1));
+                assert(*actual.emplace_hint(actual.begin() + offset, key) == key);
+                expected.insert(key);
+                break;
+            }
+        case 3:
+            assert(actual.erase(key) == expected.erase(key));
+            break;
+        case 4:
+            assert(actual.count(key) == expected.count(key));
+            assert(actual.contains(key) == expected.contains(key));
+            break;
+        case 5:
+            {
+                assert(distance(actual.begin(), actual.lower_bound(key))
+                       == distance(expected.begin(), expected.lower_bound(key)));
+                assert(distance(actual.begin(), actual.upper_bound(key))
+                       == distance(expected.begin(), expected.upper_bound(key)));
+                const auto [first, last] = actual.equal_range(key);
+                assert(static_cast<size_t>(last - first) == expected.count(key));
+                break;
+            }
+        case 6:
+            {
+                const auto keys = random_keys();
+                actual.insert(keys.begin(), keys.end());
+                expected.insert(keys.begin(), keys.end());
+                break;
+            }
+        case 7:
+            {
+                auto keys = random_keys();
+                sort(keys.begin(), keys.end());
+                if constexpr (multi) {
+                    actual.insert(sorted_equivalent, keys.begin(), keys.end());
+                } else {
+                    keys.erase(unique(keys.begin(), keys.end()), keys.end());
+                    actual.insert(sorted_unique, keys.begin(), keys.end());
+                }
+                expected.insert(keys.begin(), keys.end());
+                break;
+            }
+        case 8:
+            {
+                const auto it = actual.find(key);
+                if (it != actual.end()) {
+                    actual.erase(it);
+                    expected.erase(expected.find(key));
+                }
+                break;
+            }
+        }
+    }
+
+    assert_same(actual, expected);
+
+    auto copied = actual;
+    assert(copied == actual);
+    auto moved = move(copied);
+    assert(copied.empty());
+    assert(moved == actual);
+
+    const auto pred = [](const int key) { return key % 3 == 0; };
+    assert(erase_if(actual, pred) == erase_if(expected, pred));
+    assert_same(actual, expected);
+
+    auto cont = move(actual).extract();
+    assert(actual.empty());
+    assert(equal(cont.begin(), cont.end(), expected.begin(), expected.end()));
+    actual.replace(move(cont));
+    assert_same(actual, expected);
+}
+
+struct string_less {
+    using is_transparent = int;
+
+    bool operator()(const string& lhs, const string& rhs) const {
+        return lhs < rhs;
+    }
+    bool operator()(const string& lhs, const char* const rhs) const {
+        return lhs < rhs;
+    }
+    bool operator()(const char* const lhs, const string& rhs) const {
+        return lhs < rhs;
+    }
+};
+
+void test_constructors() {
+    flat_set<int> a{5, 3, 1, 3, 5};
+    assert(a.size() == 3);
+    assert(*a.begin() == 1);
+
+    flat_set<int> b(vector<int>{9, 1, 9, 4});
+    assert(b.size() == 3);
+    assert(*b.begin() == 1);
+
+    flat_set<int, greater<int>> descending({1, 2, 3});
+    assert(*descending.begin() == 3);
+
+    flat_multiset<int> ms{3, 1, 3};
+    assert(ms.size() == 3);
+    assert(ms.count(3) == 2);
+
+    flat_set<int> presorted(sorted_unique, {1, 2, 3});
+    assert(presorted.size() == 3);
+
+    flat_set<int> from_rng(from_range, vector<int>{4, 4, 2});
+    assert(from_rng.size() == 2);
+
+    a = {7, 8};
+    assert(a.size() == 2);
+    swap(a, b);
+    assert(b.size() == 2);
+    assert(a.size() == 3);
+
+    a.swap(b);
+    assert(a.size() == 2);
+    ms.swap(ms);
+    assert(ms.size() == 3);
+
+    static_assert(is_same_v<decltype(&flat_set<int>::swap), void (flat_set<int>::*)(flat_set<int>&) noexcept>);
+    static_assert(
+        is_same_v<decltype(&flat_multiset<int>::swap), void (flat_multiset<int>::*)(flat_multiset<int>&) noexcept>);
+}
+
+void test_deduction_guides() {
+    flat_set s1(vector<int>{1, 2});
+    static_assert(is_same_v<decltype(s1), flat_set<int>>);
+
+    flat_set s2{1, 2};
+    static_assert(is_same_v<decltype(s2), flat_set<int>>);
+
+    vector<long> longs{1, 2};
+    flat_set s3(longs.begin(), longs.end());
+    static_assert(is_same_v<decltype(s3), flat_set<long>>);
+
+    flat_multiset s4(sorted_equivalent, deque<int>{1, 1});
+    static_assert(is_same_v<decltype(s4), flat_multiset<int, less<int>, deque<int>>>);
+
+    flat_set s5(from_range, longs);
+    static_assert(is_same_v<decltype(s5), flat_set<long>>);
+}
+
+void test_allocators() {
+    using pmr_set = flat_set<int, less<int>, pmr::vector<int>>;
+    static_assert(uses_allocator_v<pmr_set, pmr::polymorphic_allocator<int>>);
+
+    pmr::monotonic_buffer_resource mr;
+    const pmr::polymorphic_allocator<int> alloc(&mr);
+
+    pmr_set p1(alloc);
+    p1.insert({3, 2, 1});
+    pmr_set p2(p1, alloc);
+    assert(p2 == p1);
+
+    pmr_set p3({5, 4}, alloc);
+    assert(p3.size() == 2);
+}
+
+void test_heterogeneous_lookup() {
+    flat_set<string, string_less> s{"b", "a"};
+    assert(s.contains("a"));
+    assert(s.find("b") != s.end());
+    assert(s.count("z") == 0);
+    assert(s.erase("a") == 1);
+    assert(s.insert("c").second);
+    assert(!s.insert("c").second);
+}
+
+void test_comparisons() {
+    assert((flat_set<int>{1, 2} < flat_set<int>{1, 3}));
+    assert((flat_set<int>{1, 2} <=> flat_set<int>{1, 2}) == 0);
+    assert((flat_multiset<int>{1, 1} != flat_multiset<int>{1}));
+}
+
+int main() {
+    test_against_set<flat_set<int>, set<int>>(1);
+    test_against_set<flat_multiset<int>, multiset<int>>(2);
+    test_against_set<flat_set<int, less<int>, deque<int>>, set<int>>(3);
+    test_against_set<flat_multiset<int, less<int>, deque<int>>, multiset<int>>(4);
+
+    test_constructors();
+    test_deduction_guides();
+    test_allocators();
+    test_heterogeneous_lookup();
+    test_comparisons();
+}
@@ -31,6 +31,10 @@ import <execution>;
 import <expected>;
 #endif // TEST_STANDARD >= 23
 import <filesystem>;
+#if TEST_STANDARD >= 23
+import <flat_map>;
+import <flat_set>;
+#endif // TEST_STANDARD >= 23
 import <format>;
 import <forward_list>;
 import <fstream>;
@@ -40,6 +44,9 @@ import <future>;
 import <generator>;
 #endif // TEST_STANDARD >= 23
 import <initializer_list>;
+#if TEST_STANDARD >= 23
+import <inplace_vector>;
+#endif // TEST_STANDARD >= 23
 import <iomanip>;
 import <ios>;
 import <iosfwd>;
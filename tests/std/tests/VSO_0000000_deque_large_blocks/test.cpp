@@ -0,0 +1,170 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _USE_DEQUE_LARGE_BLOCKS 1
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+size_t g_block_allocations   = 0;
+size_t g_largest_block_count = 0;
+
+template <class T, class Elem>
+struct counting_allocator { // counts the allocations of blocks, ignoring the map and any container proxy
+    using value_type = T;
+
+    template <class U>
+    struct rebind {
+        using other = counting_allocator<U, Elem>;
+    };
+
+    counting_allocator() = default;
+    template <class U>
+    counting_allocator(const counting_allocator<U, Elem>&) noexcept {}
+
+    T* allocate(const size_t n) {
+        if constexpr (is_same_v<T, Elem>) {
+            ++g_block_allocations;
+            g_largest_block_count = (max)(g_largest_block_count, n);
+        }
+        return allocator<T>{}.allocate(n);
+    }
+    void deallocate(T* const p, const size_t n) noexcept {
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const counting_allocator<U, Elem>&) const noexcept {
+        return true;
+    }
+#if !_HAS_CXX20
+    template <class U>
+    bool operator!=(const counting_allocator<U, Elem>&) const noexcept {
+        return false;
+    }
+#endif // !_HAS_CXX20
+};
+
+template <size_t Size>
+struct payload {
+    unsigned char bytes[Size];
+};
+
+template <class T>
+size_t block_count_for() {
+    g_block_allocations   = 0;
+    g_largest_block_count = 0;
+    deque<T, counting_allocator<T, T>> d;
+    d.push_back(T{});
+    assert(g_block_allocations == 1);
+    return g_largest_block_count;
+}
+
+void test_block_sizes() {
+    // blocks hold about 4 KiB, and never fewer than 16 elements
+    assert(block_count_for<char>() == 4096);
+    assert(block_count_for<int>() == 1024);
+    assert(block_count_for<double>() == 512);
+    assert(block_count_for<payload<24>>() == 128);
+    assert(block_count_for<payload<128>>() == 32);
+    assert(block_count_for<payload<1000>>() == 16);
+}
+
+void test_queue_reuses_blocks() {
+    // A queue that never holds more than a block's worth of elements wraps around the smallest map (8 slots),
+    // reusing the block in each slot instead of allocating new ones.
+    g_block_allocations = 0;
+    deque<int, counting_allocator<int, int>> q;
+    int next_pushed = 0;
+    int next_popped = 0;
+    for (int round = 0; round < 1000; ++round) {
+        for (int i = 0; i < 300; ++i) {
+            q.push_back(next_pushed++);
+        }
+        while (q.size() > 100) {
+            assert(q.front() == next_popped++);
+            q.pop_front();
+        }
+    }
+
+    assert(g_block_allocations <= 8);
+}
+
+void test_against_vector() {
+    mt19937 gen(1729);
+    deque<string> actual;
+    vector<string> expected;
+
+    for (int op = 0; op < 50000; ++op) {
+        const auto val = to_string(gen());
+        switch (gen() % 8) {
+        case 0:
+        case 1:
+            actual.push_back(val);
+            expected.push_back(val);
+            break;
+        case 2:
+            actual.push_front(val);
+            expected.insert(expected.begin(), val);
+            break;
+        case 3:
+            if (!expected.empty()) {
+                actual.pop_front();
+                expected.erase(expected.begin());
+            }
+            break;
+        case 4:
+            if (!expected.empty()) {
+                actual.pop_back();
+                expected.pop_back();
+            }
+            break;
+        case 5:
+            {
+                const auto off   = static_cast<ptrdiff_t>(gen() % (expected.size() + 1));
+                const auto count = gen() % 3000;
+                actual.insert(actual.begin() + off, count, val);
+                expected.insert(expected.begin() + off, count, val);
+                break;
+            }
+        case 6:
+            if (!expected.empty()) {
+                const auto first = static_cast<ptrdiff_t>(gen() % expected.size());
+                const auto count = static_cast<ptrdiff_t>(gen() % (expected.size() - static_cast<size_t>(first) + 1));
+                actual.erase(actual.begin() + first, actual.begin() + first + count);
+                expected.erase(expected.begin() + first, expected.begin() + first + count);
+            }
+            break;
+        case 7:
+            if (gen() % 100 == 0) {
+                actual.shrink_to_fit();
+            }
+            break;
+        }
+
+        assert(actual.size() == expected.size());
+    }
+
+    assert(equal(actual.begin(), actual.end(), expected.begin(), expected.end()));
+    assert(equal(actual.rbegin(), actual.rend(), expected.rbegin(), expected.rend()));
+    for (size_t i = 0; i < expected.size(); i += 97) {
+        assert(actual[i] == expected[i]);
+        const auto it = actual.begin() + static_cast<ptrdiff_t>(i);
+        assert(actual.end() - it == static_cast<ptrdiff_t>(expected.size() - i));
+    }
+}
+
+int main() {
+    test_block_sizes();
+    test_queue_reuses_blocks();
+    test_against_vector();
+}
@@ -0,0 +1,420 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+using namespace std;
+using stdext::flat_hash_map;
+using stdext::flat_hash_set;
+
+int g_live = 0;
+
+struct tracked {
+    string str;
+
+    explicit tracked(string s) : str(move(s)) {
+        ++g_live;
+    }
+    tracked(const tracked& other) : str(other.str) {
+        ++g_live;
+    }
+    tracked(tracked&& other) noexcept : str(move(other.str)) {
+        ++g_live;
+    }
+    tracked& operator=(const tracked&) = default;
+    tracked& operator=(tracked&&)      = default;
+    ~tracked() {
+        --g_live;
+    }
+
+    friend bool operator==(const tracked& lhs, const tracked& rhs) {
+        return lhs.str == rhs.str;
+    }
+};
+
+struct colliding_hash {
+    size_t operator()(const int key) const noexcept {
+        return static_cast<size_t>(key % 7); // everything lands in the same group
+    }
+};
+
+template <class Map>
+void assert_same(const Map& actual, const unordered_map<int, string>& expected) {
+    assert(actual.size() == expected.size());
+    size_t visited = 0;
+    for (const auto& [key, val] : actual) {
+        ++visited;
+        const auto it = expected.find(key);
+        assert(it != expected.end());
+        assert(it->second == val.str);
+    }
+    assert(visited == expected.size());
+    for (const auto& [key, val] : expected) {
+        const auto it = actual.find(key);
+        assert(it != actual.end());
+        assert(it->second.str == val);
+    }
+}
+
+template <class Hasher>
+void test_against_unordered_map(const unsigned int seed, const int key_range) {
+    mt19937 gen(seed);
+    flat_hash_map<int, tracked, Hasher> actual;
+    unordered_map<int, string> expected;
+
+    for (int op = 0; op < 20000; ++op) {
+        const int key = static_cast<int>(gen() % static_cast<unsigned int>(key_range));
+        switch (gen() % 8) {
+        case 0:
+        case 1:
+            {
+                const string val = to_string(gen());
+                const auto ours  = actual.try_emplace(key, val);
+                const auto other = expected.try_emplace(key, val);
+                assert(ours.second == other.second);
+                assert(ours.first->second.str == other.first->second);
+                break;
+            }
+        case 2:
+            {
+                const string val = to_string(gen());
+                const auto ours  = actual.emplace(piecewise_construct, forward_as_tuple(key), forward_as_tuple(val));
+                assert(ours.second == expected.emplace(key, val).second);
+                break;
+            }
+        case 3:
+            {
+                const string val = to_string(gen());
+                actual.insert_or_assign(key, tracked{val});
+                expected.insert_or_assign(key, val);
+                break;
+            }
+        case 4:
+            assert(actual.erase(key) == expected.erase(key));
+            break;
+        case 5:
+            {
+                const auto it = actual.find(key);
+                if (it != actual.end()) {
+                    actual.erase(it);
+                    expected.erase(key);
+                }
+                break;
+            }
+        case 6:
+            assert(actual.contains(key) == (expected.count(key) == 1));
+            assert(actual.count(key) == expected.count(key));
+            break;
+        case 7:
+            if (gen() % 500 == 0) {
+                auto copied = actual;
+                assert_same(copied, expected);
+                auto moved = move(copied);
+                assert_same(moved, expected);
+                copied = moved;
+                assert(copied == actual);
+                actual.swap(moved);
+                if (gen() % 4 == 0) {
+                    actual.clear();
+                    expected.clear();
+                }
+                actual.rehash(0);
+            }
+            break;
+        }
+    }
+
+    assert_same(actual, expected);
+
+    for (auto it = actual.begin(); it != actual.end();) {
+        if (it->first % 2 != 0) {
+            expected.erase(it->first);
+            it = actual.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    assert_same(actual, expected);
+    assert(static_cast<size_t>(g_live) == actual.size());
+}
+
+void test_map_interface() {
+    flat_hash_map<string, int> m;
+    m["x"] = 1;
+    m.insert({"y", 2});
+    m.insert(make_pair(string{"z"}, 3));
+    m.emplace("w", 4);
+    assert(m.size() == 4);
+    assert(m.at("x") == 1);
+    assert(as_const(m).find("w")->second == 4);
+    assert(m.bucket_count() >= 16);
+    assert(m.load_factor() > 0.0f && m.load_factor() <= m.max_load_factor());
+
+    try {
+        (void) m.at("missing");
+        assert(false);
+    } catch (const out_of_range&) {
+    }
+
+    flat_hash_map<int, int> big;
+    big.reserve(1000);
+    const auto buckets = big.bucket_count();
+    for (int i = 0; i < 1000; ++i) {
+        big[i] = i;
+    }
+    assert(big.bucket_count() == buckets); // reserve() avoids rehashing
+    for (int i = 0; i < 1000; ++i) {
+        assert(big.at(i) == i);
+    }
+
+    big.erase(big.begin(), big.end());
+    assert(big.empty());
+    assert(big.begin() == big.end());
+}
+
+void test_set_interface() {
+    flat_hash_set<string> s{"a", "b", "c"};
+    assert(s.size() == 3);
+    assert(s.contains("b"));
+    assert(!s.contains("z"));
+    assert(!s.insert("b").second);
+    s.emplace("d");
+    s.emplace(3, 'x');
+    assert(s.size() == 5);
+    assert(s.contains("xxx"));
+    assert(s.erase("a") == 1);
+
+    const unordered_set<string> expected(s.begin(), s.end());
+    assert(expected.size() == s.size());
+
+    flat_hash_set<string> other(s.begin(), s.end());
+    assert(other == s);
+    other.insert("zz");
+    assert(other != s);
+
+    static_assert(is_same_v<flat_hash_set<int>::iterator, flat_hash_set<int>::const_iterator>);
+}
+
+template <class T>
+struct id_allocator {
+    using value_type                             = T;
+    using propagate_on_container_copy_assignment = true_type;
+    using propagate_on_container_move_assignment = false_type;
+    using is_always_equal                        = false_type;
+
+    int id;
+
+    explicit id_allocator(const int id_) noexcept : id(id_) {}
+    template <class U>
+    id_allocator(const id_allocator<U>& other) noexcept : id(other.id) {}
+
+    T* allocate(const size_t n) {
+        return allocator<T>{}.allocate(n);
+    }
+    void deallocate(T* const p, const size_t n) noexcept {
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const id_allocator<U>& other) const noexcept {
+        return id == other.id;
+    }
+#if !_HAS_CXX20
+    template <class U>
+    bool operator!=(const id_allocator<U>& other) const noexcept {
+        return id != other.id;
+    }
+#endif // !_HAS_CXX20
+};
+
+void test_allocator_propagation() {
+    using alloc = id_allocator<pair<const int, string>>;
+    using map   = flat_hash_map<int, string, hash<int>, equal_to<int>, alloc>;
+
+    map a(alloc{1});
+    for (int i = 0; i < 100; ++i) {
+        a[i] = to_string(i);
+    }
+
+    map b(alloc{2});
+    b = move(a); // unequal allocators that do not propagate, so elements are moved one by one
+    assert(b.size() == 100);
+    assert(b.get_allocator().id == 2);
+    assert(b.at(42) == "42");
+
+    map c(move(b), alloc{3});
+    assert(c.size() == 100);
+    assert(c.get_allocator().id == 3);
+
+    map d(alloc{4});
+    d = c;
+    assert(d.get_allocator().id == 3);
+    assert(d == c);
+}
+
+int g_copies_remaining = 1000000;
+
+struct throwing_copy {
+    int val;
+
+    explicit throwing_copy(const int v) : val(v) {}
+    throwing_copy(const throwing_copy& other) : val(other.val) {
+        if (--g_copies_remaining == 0) {
+            throw runtime_error{"copy"};
+        }
+    }
+    throwing_copy(throwing_copy&& other) noexcept(false) : val(other.val) {}
+    throwing_copy& operator=(const throwing_copy&) = default;
+};
+
+void test_strong_guarantee() {
+    // Elements with a potentially-throwing move are copied during rehashing, so the table survives a failure.
+    flat_hash_map<int, throwing_copy> m;
+    for (int i = 0; i < 14; ++i) {
+        m.try_emplace(i, i);
+    }
+
+    g_copies_remaining = 5;
+    try {
+        for (int i = 14; i < 100; ++i) {
+            m.try_emplace(i, i);
+        }
+        assert(false);
+    } catch (const runtime_error&) {
+    }
+
+    assert(m.size() == 14);
+    for (int i = 0; i < 14; ++i) {
+        assert(m.at(i).val == i);
+    }
+
+    g_copies_remaining = 1000000;
+    for (int i = 14; i < 100; ++i) {
+        m.try_emplace(i, i);
+    }
+
+    g_copies_remaining = 50;
+    flat_hash_map<int, throwing_copy> target;
+    try {
+        target = m;
+        assert(false);
+    } catch (const runtime_error&) {
+    }
+
+    assert(target.empty());
+    assert(target.begin() == target.end());
+    g_copies_remaining = 1000000;
+}
+
+string long_string(const int i) {
+    return to_string(i) + "-padding-to-defeat-the-small-string-optimization";
+}
+
+void test_aliasing_insert() {
+    // The inserted key or value may refer to an element of the map, including when the insertion grows the table and
+    // moves that element away.
+    int growths = 0;
+    flat_hash_map<int, string> values;
+    values.try_emplace(0, long_string(0));
+    for (int i = 1; i < 300; ++i) {
+        const auto buckets = values.bucket_count();
+        assert(values.try_emplace(i, values.at(i - 1)).second);
+        assert(values.at(i) == long_string(0));
+        if (values.bucket_count() != buckets) {
+            ++growths;
+        }
+    }
+    assert(growths > 1);
+
+    growths = 0;
+    flat_hash_map<string, string> keys; // each element's value is the next key
+    keys.try_emplace(long_string(0), long_string(1));
+    for (int i = 1; i < 300; ++i) {
+        const auto buckets = keys.bucket_count();
+        const auto result  = keys.try_emplace(keys.at(long_string(i - 1)), long_string(i + 1));
+        assert(result.second);
+        assert(result.first->first == long_string(i));
+        if (keys.bucket_count() != buckets) {
+            ++growths;
+        }
+    }
+    assert(growths > 1);
+    for (int i = 0; i < 300; ++i) {
+        assert(keys.at(long_string(i)) == long_string(i + 1));
+    }
+}
+
+void test_small_bucket_counts() {
+    // A table is never smaller than one 16-slot group, however few buckets are asked for.
+    for (size_t buckets = 1; buckets < 16; ++buckets) {
+        flat_hash_map<int, int> empty_map;
+        empty_map.rehash(buckets);
+        assert(empty_map.bucket_count() == 16);
+        for (int i = 0; i < 14; ++i) {
+            empty_map[i] = i;
+        }
+        assert(empty_map.size() == 14);
+        assert(empty_map.find(14) == empty_map.end());
+
+        flat_hash_map<int, int> full_map;
+        for (int i = 0; i < 10; ++i) {
+            full_map[i] = i;
+        }
+        full_map.rehash(buckets);
+        assert(full_map.bucket_count() == 16);
+        for (int i = 0; i < 10; ++i) {
+            assert(full_map.at(i) == i);
+        }
+
+        flat_hash_map<int, int> constructed_map(buckets);
+        assert(constructed_map.bucket_count() == 16);
+        constructed_map.emplace(1, 2);
+        assert(constructed_map.at(1) == 2);
+        assert(constructed_map.find(3) == constructed_map.end());
+
+        flat_hash_set<int> constructed_set(buckets);
+        assert(constructed_set.bucket_count() == 16);
+        for (int i = 0; i < 20; ++i) {
+            constructed_set.insert(i);
+        }
+        assert(constructed_set.size() == 20);
+        assert(constructed_set.contains(19));
+        assert(!constructed_set.contains(20));
+
+        const flat_hash_set<int> list_set({1, 2, 3}, buckets);
+        assert(list_set.bucket_count() == 16);
+        assert(list_set.contains(2));
+    }
+
+    flat_hash_map<int, int> unallocated;
+    unallocated.rehash(0);
+    assert(unallocated.bucket_count() == 0);
+    assert(unallocated.find(0) == unallocated.end());
+}
+
+int main() {
+    test_against_unordered_map<hash<int>>(1, 50);
+    test_against_unordered_map<hash<int>>(2, 5000);
+    test_against_unordered_map<hash<int>>(3, 100000);
+    test_against_unordered_map<colliding_hash>(4, 300);
+    assert(g_live == 0);
+
+    test_map_interface();
+    test_set_interface();
+    test_allocator_propagation();
+    test_strong_guarantee();
+    test_aliasing_insert();
+    test_small_bucket_counts();
+}
@@ -0,0 +1,106 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _USE_PARALLEL_ALGORITHMS_WORK_STEALING 1
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+void test_case_for_each(const size_t testSize) {
+    // every element is visited exactly once, whichever worker runs its chunk
+    vector<int> visits(testSize);
+    for_each(par, visits.begin(), visits.end(), [](int& visit) { ++visit; });
+    assert(all_of(visits.begin(), visits.end(), [](const int visit) { return visit == 1; }));
+}
+
+void test_case_sort(const size_t testSize, mt19937& gen) {
+    // the parallel sort's callbacks resubmit themselves when they can't find work to steal
+    vector<size_t> c(testSize);
+    iota(c.begin(), c.end(), size_t{0});
+    shuffle(c.begin(), c.end(), gen);
+    sort(par, c.begin(), c.end());
+    assert(is_sorted(c.begin(), c.end()));
+
+    shuffle(c.begin(), c.end(), gen);
+    stable_sort(par, c.begin(), c.end(), greater<>{});
+    assert(is_sorted(c.begin(), c.end(), greater<>{}));
+}
+
+void test_case_reduce_and_scan(const size_t testSize) {
+    vector<size_t> c(testSize);
+    iota(c.begin(), c.end(), size_t{1});
+    const size_t expectedSum = testSize * (testSize + 1) / 2;
+    assert(reduce(par, c.begin(), c.end()) == expectedSum);
+    assert(transform_reduce(par, c.begin(), c.end(), size_t{0}, plus<>{}, [](size_t x) { return x * 2; })
+           == expectedSum * 2);
+
+    // each chunk of a scan waits for the chunk before it
+    vector<size_t> sums(testSize);
+    inclusive_scan(par, c.begin(), c.end(), sums.begin());
+    for (size_t idx = 0; idx < testSize; ++idx) {
+        assert(sums[idx] == (idx + 1) * (idx + 2) / 2);
+    }
+}
+
+void test_nested_algorithms() {
+    // algorithms started from a worker push their work onto that worker's deque, where idle workers steal it
+    mt19937 gen(1729);
+    vector<vector<int>> rows(64, vector<int>(2000));
+    for (auto& row : rows) {
+        iota(row.begin(), row.end(), 0);
+        shuffle(row.begin(), row.end(), gen);
+    }
+
+    for_each(par, rows.begin(), rows.end(), [](vector<int>& row) {
+        sort(par, row.begin(), row.end());
+        assert(reduce(par, row.begin(), row.end(), 0LL) == 1999LL * 2000 / 2);
+    });
+
+    for (const auto& row : rows) {
+        assert(is_sorted(row.begin(), row.end()));
+    }
+}
+
+void test_concurrent_submitters() {
+    // threads that aren't workers submit through the shared injection queue
+    vector<thread> submitters;
+    for (unsigned int seed = 0; seed < 4; ++seed) {
+        submitters.emplace_back([seed] {
+            mt19937 gen(seed);
+            vector<int> c(10000);
+            for (int round = 0; round < 20; ++round) {
+                iota(c.begin(), c.end(), 0);
+                shuffle(c.begin(), c.end(), gen);
+                sort(par, c.begin(), c.end());
+                assert(is_sorted(c.begin(), c.end()));
+                assert(count_if(par, c.begin(), c.end(), [](int x) { return x % 2 == 0; }) == 5000);
+            }
+        });
+    }
+
+    for (auto& submitter : submitters) {
+        submitter.join();
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+
+    parallel_test_case(test_case_for_each);
+    parallel_test_case(test_case_sort, gen);
+    parallel_test_case(test_case_reduce_and_scan);
+    test_nested_algorithms();
+    test_concurrent_submitters();
+}
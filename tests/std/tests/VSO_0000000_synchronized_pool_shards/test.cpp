@@ -0,0 +1,121 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _USE_SYNCHRONIZED_POOL_SHARDS 1
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+struct allocation {
+    void* ptr;
+    size_t size;
+    size_t align;
+};
+
+struct recording_resource : pmr::memory_resource { // single-threaded record of the blocks taken from upstream
+    vector<allocation> allocations;
+
+    void* do_allocate(const size_t bytes, const size_t align) override {
+        void* const result = pmr::new_delete_resource()->allocate(bytes, align);
+        allocations.push_back({result, bytes, align});
+        return result;
+    }
+
+    void do_deallocate(void* const ptr, const size_t bytes, const size_t align) override {
+        const auto pos = find_if(allocations.begin(), allocations.end(),
+            [&](const allocation& a) { return a.ptr == ptr && a.size == bytes && a.align == align; });
+        assert(pos != allocations.end());
+        allocations.erase(pos);
+        pmr::new_delete_resource()->deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const memory_resource& that) const noexcept override {
+        return this == &that;
+    }
+};
+
+size_t size_of(const size_t i) {
+    return size_t{8} << (i % 8);
+}
+
+void test_threads() {
+    // blocks are allocated on one thread and deallocated on another, while that thread may hold its own shard
+    constexpr size_t thread_count = 8;
+    constexpr size_t block_count  = 1000;
+    pmr::synchronized_pool_resource spr;
+    vector<vector<unsigned char*>> blocks(thread_count);
+
+    const auto run = [&](const auto& fn) {
+        vector<thread> threads;
+        for (size_t t = 0; t < thread_count; ++t) {
+            threads.emplace_back(fn, t);
+        }
+        for (auto& th : threads) {
+            th.join();
+        }
+    };
+
+    for (int round = 0; round < 3; ++round) {
+        run([&](const size_t t) {
+            for (size_t i = 0; i < block_count; ++i) {
+                const auto ptr = static_cast<unsigned char*>(spr.allocate(size_of(i), alignof(void*)));
+                fill_n(ptr, size_of(i), static_cast<unsigned char>(t));
+                blocks[t].push_back(ptr);
+            }
+        });
+
+        run([&](const size_t t) {
+            const size_t owner = (t + 1) % thread_count;
+            auto& theirs       = blocks[owner];
+            for (size_t i = 0; i < block_count; ++i) {
+                assert(all_of(theirs[i], theirs[i] + size_of(i),
+                    [owner](const unsigned char c) { return c == static_cast<unsigned char>(owner); }));
+                spr.deallocate(theirs[i], size_of(i), alignof(void*));
+            }
+            theirs.clear();
+        });
+    }
+}
+
+void test_release() {
+    // release discards the cached blocks, and destruction returns everything, including the shard table, upstream
+    recording_resource rr;
+    {
+        pmr::synchronized_pool_resource spr{&rr};
+        vector<void*> ptrs;
+        for (size_t i = 0; i < 100; ++i) {
+            ptrs.push_back(spr.allocate(size_of(i), alignof(void*)));
+        }
+
+        // the shard table is padded so that neighboring shards don't share cache lines
+        assert(any_of(rr.allocations.begin(), rr.allocations.end(),
+            [](const allocation& a) { return a.align == hardware_destructive_interference_size; }));
+
+        for (size_t i = 0; i < ptrs.size(); ++i) {
+            spr.deallocate(ptrs[i], size_of(i), alignof(void*));
+        }
+
+        spr.release();
+        for (size_t i = 0; i < 100; ++i) {
+            void* const ptr = spr.allocate(size_of(i), alignof(void*));
+            spr.deallocate(ptr, size_of(i), alignof(void*));
+        }
+
+        // requests too large for the shards go straight to the shared pools
+        void* const big = spr.allocate(4096, alignof(void*));
+        spr.deallocate(big, 4096, alignof(void*));
+    }
+    assert(rr.allocations.empty());
+}
+
+int main() {
+    test_threads();
+    test_release();
+}
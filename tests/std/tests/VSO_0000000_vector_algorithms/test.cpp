@@ -5,6 +5,7 @@
 #include <bitset>
 #include <cassert>
 #include <climits>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
@@ -537,6 +538,165 @@ void test_min_max_element_special_cases() {
            == v.begin() + 2 * block_size_in_elements + last_vector_first_elem + 9);
 }
 
+template <class FwdIt>
+FwdIt last_known_good_adjacent_find(FwdIt first, const FwdIt last) {
+    if (first == last) {
+        return last;
+    }
+
+    for (auto next = first; ++next != last; first = next) {
+        if (*first == *next) {
+            return first;
+        }
+    }
+
+    return last;
+}
+
+template <class T>
+void test_case_adjacent_find(const vector<T>& input) {
+    const auto expected = last_known_good_adjacent_find(input.begin(), input.end());
+    const auto actual   = adjacent_find(input.begin(), input.end());
+    assert(expected == actual);
+
+#if _HAS_CXX20
+    const auto actual_r = ranges::adjacent_find(input);
+    assert(expected == actual_r);
+#endif // _HAS_CXX20
+}
+
+template <class T>
+void test_adjacent_find(mt19937_64& gen) {
+    using TD = conditional_t<sizeof(T) == 1, int, T>;
+    uniform_int_distribution<TD> dis(1, 20);
+    vector<T> input;
+    input.reserve(dataCount);
+    test_case_adjacent_find(input);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        // keep neighbors distinct, so that the pair planted below is the first one
+        input.push_back(static_cast<T>(input.empty() ? 0 : input.back() + static_cast<T>(dis(gen))));
+        test_case_adjacent_find(input);
+
+        const size_t pos = static_cast<size_t>(gen() % input.size());
+        const T saved    = input[pos];
+        input[pos]       = input[pos == 0 ? 0 : pos - 1];
+        test_case_adjacent_find(input);
+        input[pos] = saved;
+    }
+}
+
+template <class FwdIt, class Pred>
+FwdIt last_known_good_is_sorted_until(FwdIt first, const FwdIt last, Pred pred) {
+    if (first == last) {
+        return last;
+    }
+
+    for (auto next = first; ++next != last; first = next) {
+        if (pred(*next, *first)) {
+            return next;
+        }
+    }
+
+    return last;
+}
+
+template <class T>
+void test_case_is_sorted_until(const vector<T>& input) {
+    const auto expected = last_known_good_is_sorted_until(input.begin(), input.end(), less<>{});
+    assert(expected == is_sorted_until(input.begin(), input.end()));
+    assert(expected == is_sorted_until(input.begin(), input.end(), less<T>{}));
+    assert((expected == input.end()) == is_sorted(input.begin(), input.end()));
+
+    const auto expected_greater = last_known_good_is_sorted_until(input.begin(), input.end(), greater<>{});
+    assert(expected_greater == is_sorted_until(input.begin(), input.end(), greater<>{}));
+
+#if _HAS_CXX20
+    assert(expected == ranges::is_sorted_until(input));
+    assert((expected == input.end()) == ranges::is_sorted(input));
+    assert(expected_greater == ranges::is_sorted_until(input, ranges::greater{}));
+#endif // _HAS_CXX20
+}
+
+template <class T>
+void test_is_sorted_until(mt19937_64& gen) {
+    vector<T> input;
+    input.reserve(dataCount);
+    test_case_is_sorted_until(input);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<T>(attempts * 100 / dataCount)); // sorted, with runs of equal elements
+        test_case_is_sorted_until(input);
+
+        // put one element out of order, or put the extremes somewhere
+        const size_t pos = static_cast<size_t>(gen() % input.size());
+        const T saved    = input[pos];
+        input[pos]       = (gen() % 2 == 0) ? numeric_limits<T>::lowest() : numeric_limits<T>::max();
+        test_case_is_sorted_until(input);
+        input[pos] = saved;
+    }
+
+    if constexpr (is_floating_point_v<T>) {
+        // NaN is neither less nor greater than anything, so it never stops the sorted prefix
+        const T nan = numeric_limits<T>::quiet_NaN();
+        input       = {T{1}, T{2}, nan, T{0}, T{3}, -T{0}, T{0}, nan, nan, T{-1}, T{5}, T{6}, T{7}, T{8}, T{9}, T{10},
+            T{11}, T{12}, T{13}, T{14}, T{15}, T{16}, T{17}, T{18}};
+        test_case_is_sorted_until(input);
+        input.erase(input.begin(), input.begin() + 4);
+        test_case_is_sorted_until(input);
+    }
+}
+
+template <class FwdIt>
+FwdIt last_known_good_unique(FwdIt first, const FwdIt last) {
+    if (first == last) {
+        return last;
+    }
+
+    FwdIt dest = first;
+    while (++first != last) {
+        if (!(*dest == *first)) {
+            *++dest = *first;
+        }
+    }
+
+    return ++dest;
+}
+
+template <class T>
+void test_case_unique(const vector<T>& input, vector<T>& expected, vector<T>& actual) {
+    expected             = input;
+    const auto exp_end   = last_known_good_unique(expected.begin(), expected.end());
+    const auto exp_count = exp_end - expected.begin();
+
+    actual             = input;
+    const auto act_end = unique(actual.begin(), actual.end());
+    assert(equal(expected.begin(), exp_end, actual.begin(), act_end));
+
+#if _HAS_CXX20
+    actual               = input;
+    const auto act_end_r = ranges::unique(actual);
+    assert(begin(act_end_r) - actual.begin() == exp_count);
+    assert(end(act_end_r) == actual.end());
+    assert(equal(expected.begin(), exp_end, actual.begin(), begin(act_end_r)));
+#else // ^^^ _HAS_CXX20 / !_HAS_CXX20 vvv
+    (void) exp_count;
+#endif // ^^^ !_HAS_CXX20 ^^^
+}
+
+template <class T>
+void test_unique(mt19937_64& gen) {
+    using TD = conditional_t<sizeof(T) == 1, int, T>;
+    binomial_distribution<TD> dis(3);
+    vector<T> input;
+    vector<T> expected;
+    vector<T> actual;
+    input.reserve(dataCount);
+    test_case_unique(input, expected, actual);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<T>(dis(gen)));
+        test_case_unique(input, expected, actual);
+    }
+}
+
 template <class FwdIt, class T>
 void last_known_good_replace(FwdIt first, FwdIt last, const T old_val, const T new_val) {
     for (; first != last; ++first) {
@@ -583,6 +743,308 @@ void test_replace(mt19937_64& gen) {
     }
 }
 
+template <class FwdIt, class T>
+void last_known_good_fill(FwdIt first, FwdIt last, const T val) {
+    for (; first != last; ++first) {
+        *first = val;
+    }
+}
+
+template <class T>
+void test_case_fill(const vector<T>& input, const T val) {
+    vector<T> expected(input);
+    last_known_good_fill(expected.begin(), expected.end(), val);
+
+    vector<T> actual(input);
+    fill(actual.begin(), actual.end(), val);
+    assert(expected == actual);
+
+    // fill_n must not store past the requested count
+    const auto half = static_cast<ptrdiff_t>(input.size() / 2);
+    vector<T> actual_n(input);
+    assert(fill_n(actual_n.begin(), half, val) == actual_n.begin() + half);
+    assert(equal(actual_n.begin(), actual_n.begin() + half, expected.begin()));
+    assert(equal(actual_n.begin() + half, actual_n.end(), input.begin() + half));
+
+#if _HAS_CXX20
+    vector<T> actual_r(input);
+    assert(ranges::fill(actual_r, val) == actual_r.end());
+    assert(expected == actual_r);
+
+    vector<T> actual_r_n(input);
+    assert(ranges::fill_n(actual_r_n.begin(), half, val) == actual_r_n.begin() + half);
+    assert(equal(actual_r_n.begin(), actual_r_n.begin() + half, expected.begin()));
+    assert(equal(actual_r_n.begin() + half, actual_r_n.end(), input.begin() + half));
+#endif // _HAS_CXX20
+}
+
+template <class T>
+void test_fill(mt19937_64& gen) {
+    using TD = conditional_t<(sizeof(T) > 4), long long, int>;
+    uniform_int_distribution<TD> dis(-1000, 1000);
+    vector<T> input;
+
+    input.reserve(dataCount);
+
+    test_case_fill(input, static_cast<T>(dis(gen)));
+
+    for (size_t i = 0; i != dataCount; ++i) {
+        input.push_back(static_cast<T>(dis(gen)));
+        test_case_fill(input, static_cast<T>(dis(gen)));
+    }
+}
+
+// Overlapping ranges that aren't exactly in place must behave like the element-by-element loop; when the
+// destination is ahead of a source, each result feeds the next, so the vector algorithms must not kick in.
+const ptrdiff_t transform_overlap_shifts[]  = {-17, -1, 1, 3, 17};
+constexpr ptrdiff_t transform_overlap_pad   = 17;
+constexpr size_t transform_overlap_max_size = 100; // enough for several vectors of every element type
+
+template <class T, class Fn>
+void test_case_transform_unary_overlap(const vector<T>& input, Fn fn) {
+    const auto size = static_cast<ptrdiff_t>(input.size());
+    vector<T> buffer(input.size() + 2 * transform_overlap_pad);
+    copy(input.begin(), input.end(), buffer.begin() + transform_overlap_pad);
+
+    for (const ptrdiff_t shift : transform_overlap_shifts) {
+        vector<T> expected(buffer);
+        for (ptrdiff_t i = transform_overlap_pad; i != transform_overlap_pad + size; ++i) {
+            expected[static_cast<size_t>(i + shift)] = static_cast<T>(fn(expected[static_cast<size_t>(i)]));
+        }
+
+        vector<T> actual(buffer);
+        const auto first = actual.begin() + transform_overlap_pad;
+        assert(transform(first, first + size, first + shift, fn) == first + shift + size);
+        assert(expected == actual);
+    }
+}
+
+template <class T, class Fn>
+void test_case_transform_binary_overlap(const vector<T>& input1, const vector<T>& input2, Fn fn) {
+    const auto size = static_cast<ptrdiff_t>(input1.size());
+    vector<T> buffer(input1.size() + 2 * transform_overlap_pad);
+    copy(input1.begin(), input1.end(), buffer.begin() + transform_overlap_pad);
+
+    for (const ptrdiff_t shift : transform_overlap_shifts) {
+        // the destination overlaps the first source
+        vector<T> expected(buffer);
+        for (ptrdiff_t i = transform_overlap_pad; i != transform_overlap_pad + size; ++i) {
+            expected[static_cast<size_t>(i + shift)] = static_cast<T>(
+                fn(expected[static_cast<size_t>(i)], input2[static_cast<size_t>(i - transform_overlap_pad)]));
+        }
+
+        vector<T> actual(buffer);
+        auto first = actual.begin() + transform_overlap_pad;
+        assert(transform(first, first + size, input2.begin(), first + shift, fn) == first + shift + size);
+        assert(expected == actual);
+
+        // the destination overlaps the second source
+        expected = buffer;
+        for (ptrdiff_t i = transform_overlap_pad; i != transform_overlap_pad + size; ++i) {
+            expected[static_cast<size_t>(i + shift)] = static_cast<T>(
+                fn(input2[static_cast<size_t>(i - transform_overlap_pad)], expected[static_cast<size_t>(i)]));
+        }
+
+        actual = buffer;
+        first  = actual.begin() + transform_overlap_pad;
+        assert(transform(input2.begin(), input2.begin() + size, first, first + shift, fn) == first + shift + size);
+        assert(expected == actual);
+    }
+}
+
+template <class T, class Fn>
+void test_case_transform_unary(const vector<T>& input, Fn fn) {
+    vector<T> expected(input.size());
+    for (size_t i = 0; i != input.size(); ++i) {
+        expected[i] = static_cast<T>(fn(input[i]));
+    }
+
+    vector<T> actual(input.size());
+    assert(transform(input.begin(), input.end(), actual.begin(), fn) == actual.end());
+    assert(expected == actual);
+
+    vector<T> in_place(input);
+    assert(transform(in_place.begin(), in_place.end(), in_place.begin(), fn) == in_place.end());
+    assert(expected == in_place);
+
+    if (input.size() <= transform_overlap_max_size) {
+        test_case_transform_unary_overlap(input, fn);
+    }
+
+#if _HAS_CXX20
+    vector<T> actual_r(input.size());
+    const auto result_r = ranges::transform(input, actual_r.begin(), fn);
+    assert(result_r.in == input.end());
+    assert(result_r.out == actual_r.end());
+    assert(expected == actual_r);
+#endif // _HAS_CXX20
+}
+
+template <class T, class Fn>
+void test_case_transform_binary(const vector<T>& input1, const vector<T>& input2, Fn fn) {
+    // input2 may be longer than input1; the extra elements are ignored
+    vector<T> expected(input1.size());
+    for (size_t i = 0; i != input1.size(); ++i) {
+        expected[i] = static_cast<T>(fn(input1[i], input2[i]));
+    }
+
+    vector<T> actual(input1.size());
+    assert(transform(input1.begin(), input1.end(), input2.begin(), actual.begin(), fn) == actual.end());
+    assert(expected == actual);
+
+    vector<T> in_place(input1);
+    assert(transform(in_place.begin(), in_place.end(), input2.begin(), in_place.begin(), fn) == in_place.end());
+    assert(expected == in_place);
+
+    if (input1.size() <= transform_overlap_max_size) {
+        test_case_transform_binary_overlap(input1, input2, fn);
+    }
+
+#if _HAS_CXX20
+    vector<T> actual_r(input1.size());
+    const auto result_r = ranges::transform(input1, input2, actual_r.begin(), fn);
+    assert(result_r.in1 == input1.end());
+    assert(result_r.in2 == input2.begin() + static_cast<ptrdiff_t>(input1.size()));
+    assert(result_r.out == actual_r.end());
+    assert(expected == actual_r);
+#endif // _HAS_CXX20
+}
+
+template <class T>
+void test_case_transform(const vector<T>& input1, const vector<T>& input2) {
+    if constexpr (is_signed_v<T>) {
+        test_case_transform_unary(input1, negate<>{});
+        test_case_transform_unary(input1, negate<T>{});
+    }
+
+    test_case_transform_binary(input1, input2, plus<>{});
+    test_case_transform_binary(input1, input2, plus<T>{});
+    test_case_transform_binary(input1, input2, minus<>{});
+    test_case_transform_binary(input1, input2, minus<T>{});
+
+    if constexpr (is_integral_v<T>) {
+        test_case_transform_unary(input1, bit_not<>{});
+        test_case_transform_unary(input1, bit_not<T>{});
+        test_case_transform_binary(input1, input2, bit_and<>{});
+        test_case_transform_binary(input1, input2, bit_or<T>{});
+        test_case_transform_binary(input1, input2, bit_xor<>{});
+    }
+}
+
+template <class T>
+void test_transform(mt19937_64& gen) {
+    using TD = conditional_t<(sizeof(T) > 4), long long, int>;
+    uniform_int_distribution<TD> dis(-1000, 1000);
+    vector<T> input1;
+    vector<T> input2;
+
+    input1.reserve(dataCount);
+    input2.reserve(dataCount + 1);
+
+    input2.push_back(static_cast<T>(dis(gen)));
+    test_case_transform(input1, input2);
+
+    for (size_t i = 0; i != dataCount; ++i) {
+        input1.push_back(static_cast<T>(dis(gen)));
+        input2.push_back(static_cast<T>(dis(gen)));
+        test_case_transform(input1, input2);
+    }
+}
+
+template <class T, class Fn>
+T last_known_good_reduce(const vector<T>& input, T init, Fn fn) {
+    for (const auto& elem : input) {
+        init = static_cast<T>(fn(init, elem));
+    }
+
+    return init;
+}
+
+template <class T, class Fn>
+void test_case_reduce(const vector<T>& input, const T init, Fn fn) {
+    const T expected = last_known_good_reduce(input, init, fn);
+    assert(accumulate(input.begin(), input.end(), init, fn) == expected);
+#if _HAS_CXX17
+    assert(reduce(input.begin(), input.end(), init, fn) == expected);
+#endif // _HAS_CXX17
+}
+
+template <class T>
+void test_reduce(mt19937_64& gen) {
+    // Small integers, and floating-point multiples of 1/8, have exact sums in any order.
+    using TD = conditional_t<(sizeof(T) > 4), long long, int>;
+    uniform_int_distribution<TD> dis(-1000, 1000);
+    vector<T> input;
+
+    input.reserve(dataCount);
+
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        const T init = static_cast<T>(dis(gen));
+        if constexpr (is_floating_point_v<T>) {
+            test_case_reduce(input, init, plus<>{});
+            test_case_reduce(input, init, plus<T>{});
+            input.push_back(static_cast<T>(dis(gen)) / 8);
+        } else {
+            test_case_reduce(input, init, plus<>{});
+            test_case_reduce(input, init, plus<T>{});
+            test_case_reduce(input, init, bit_and<>{});
+            test_case_reduce(input, static_cast<T>(~T{0}), bit_and<T>{});
+            test_case_reduce(input, init, bit_or<>{});
+            test_case_reduce(input, init, bit_xor<T>{});
+            input.push_back(static_cast<T>(dis(gen)));
+        }
+    }
+}
+
+template <class FwdIt, class T, class Pred>
+void test_case_lower_bound_batch(FwdIt first, FwdIt last, const vector<T>& keys, Pred pred) {
+    vector<ptrdiff_t> expected;
+    for (const auto& key : keys) {
+        expected.push_back(distance(first, lower_bound(first, last, key, pred)));
+    }
+
+    vector<ptrdiff_t> actual(keys.size() + 1, -1);
+    const auto result = stdext::lower_bound_batch(first, last, keys.begin(), keys.end(), actual.begin(), pred);
+    assert(result == actual.begin() + static_cast<ptrdiff_t>(keys.size()));
+    assert(actual.back() == -1);
+    actual.pop_back();
+    assert(expected == actual);
+}
+
+template <class T>
+void test_lower_bound_batch(mt19937_64& gen) {
+    using TD = conditional_t<(sizeof(T) > 4), long long, int>;
+    uniform_int_distribution<TD> dis(-100, 100);
+    vector<T> haystack;
+    vector<T> keys;
+
+    haystack.reserve(haystackDataCount);
+    keys.reserve(needleDataCount + 2);
+
+    for (size_t attempts = 0; attempts < haystackDataCount; ++attempts) {
+        keys.assign({(numeric_limits<T>::min)(), (numeric_limits<T>::max)()});
+        const size_t key_count = static_cast<size_t>(dis(gen) + 100) % needleDataCount;
+        for (size_t i = 0; i != key_count; ++i) {
+            keys.push_back(static_cast<T>(dis(gen)));
+        }
+
+        sort(haystack.begin(), haystack.end());
+        test_case_lower_bound_batch(haystack.begin(), haystack.end(), keys, less<>{});
+        test_case_lower_bound_batch(haystack.begin(), haystack.end(), keys, less<T>{});
+
+        const deque<T> haystack_deque(haystack.begin(), haystack.end());
+        test_case_lower_bound_batch(haystack_deque.begin(), haystack_deque.end(), keys, less<>{});
+
+        const list<T> haystack_list(haystack.begin(), haystack.end());
+        test_case_lower_bound_batch(haystack_list.begin(), haystack_list.end(), keys, less<>{});
+
+        sort(haystack.begin(), haystack.end(), greater<>{});
+        test_case_lower_bound_batch(haystack.begin(), haystack.end(), keys, greater<>{});
+
+        haystack.push_back(static_cast<T>(dis(gen)));
+    }
+}
+
 template <class BidIt>
 void last_known_good_reverse(BidIt first, BidIt last) {
     for (; first != last && first != --last; ++first) {
@@ -631,6 +1093,47 @@ void test_reverse_copy(mt19937_64& gen) {
     }
 }
 
+template <class FwdIt>
+FwdIt last_known_good_rotate(FwdIt first, FwdIt mid, FwdIt last) {
+    const auto result = next(first, distance(mid, last));
+    last_known_good_reverse(first, mid);
+    last_known_good_reverse(mid, last);
+    last_known_good_reverse(first, last);
+    return result;
+}
+
+template <class T>
+void test_case_rotate(const vector<T>& input, const size_t mid) {
+    auto expected           = input;
+    const auto expected_pos = last_known_good_rotate(expected.begin(), expected.begin() + mid, expected.end());
+
+    auto actual           = input;
+    const auto actual_pos = rotate(actual.begin(), actual.begin() + mid, actual.end());
+    assert(expected == actual);
+    assert(actual_pos - actual.begin() == expected_pos - expected.begin());
+
+#if _HAS_CXX20
+    auto actual_r           = input;
+    const auto actual_r_pos = ranges::rotate(actual_r, actual_r.begin() + mid);
+    assert(expected == actual_r);
+    assert(actual_r_pos.begin() - actual_r.begin() == expected_pos - expected.begin());
+    assert(actual_r_pos.end() == actual_r.end());
+#endif // _HAS_CXX20
+}
+
+template <class T>
+void test_rotate(mt19937_64& gen) {
+    vector<T> input;
+    input.reserve(dataCount);
+    test_case_rotate(input, 0);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<T>(gen())); // intentionally narrows
+        test_case_rotate(input, 0);
+        test_case_rotate(input, input.size());
+        test_case_rotate(input, static_cast<size_t>(gen() % (input.size() + 1)));
+    }
+}
+
 template <class FwdIt1, class FwdIt2>
 FwdIt2 last_known_good_swap_ranges(FwdIt1 first1, const FwdIt1 last1, FwdIt2 dest) {
     for (; first1 != last1; ++first1, ++dest) {
@@ -696,6 +1199,90 @@ void test_remove(mt19937_64& gen) {
     }
 }
 
+template <class T>
+void test_case_sort(const vector<T>& input, vector<T>& actual, vector<T>& expected) {
+    // operator== can't tell +0.0 from -0.0, so also check that the output has as many of each as the input
+    const auto count_negative = [](const vector<T>& v) {
+        if constexpr (is_floating_point_v<T>) {
+            return count_if(v.begin(), v.end(), [](const T x) { return signbit(x); });
+        } else {
+            return count_if(v.begin(), v.end(), [](const T x) { return x < T{0}; });
+        }
+    };
+    const auto negative = count_negative(input);
+
+    expected = input;
+    stable_sort(expected.begin(), expected.end()); // not vectorized
+    actual = input;
+    sort(actual.begin(), actual.end());
+    assert(expected == actual);
+    assert(count_negative(actual) == negative);
+
+    actual = input;
+    sort(actual.begin(), actual.end(), less<T>{});
+    assert(expected == actual);
+    assert(count_negative(actual) == negative);
+
+    actual = input;
+    sort(actual.begin(), actual.end(), greater<>{});
+    assert(equal(expected.rbegin(), expected.rend(), actual.begin(), actual.end()));
+    assert(count_negative(actual) == negative);
+
+#if _HAS_CXX20
+    actual = input;
+    ranges::sort(actual);
+    assert(expected == actual);
+    assert(count_negative(actual) == negative);
+
+    actual = input;
+    assert(ranges::sort(actual.begin(), actual.end(), ranges::greater{}) == actual.end());
+    assert(equal(expected.rbegin(), expected.rend(), actual.begin(), actual.end()));
+    assert(count_negative(actual) == negative);
+#endif // _HAS_CXX20
+}
+
+template <class T>
+void test_sort(mt19937_64& gen) {
+    vector<T> input;
+    vector<T> actual;
+    vector<T> expected;
+    input.reserve(dataCount);
+
+    // alternate between wide values and a few repeated ones, so that both distinct and equal pivots are exercised
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        const auto bits = gen();
+        if (attempts % 2 == 0) {
+            if constexpr (is_floating_point_v<T>) {
+                input.push_back(static_cast<T>(static_cast<int64_t>(bits)) / static_cast<T>(1ULL << 40));
+            } else {
+                input.push_back(static_cast<T>(bits)); // intentionally narrows
+            }
+        } else {
+            input.push_back(static_cast<T>(bits % 5));
+        }
+
+        test_case_sort(input, actual, expected);
+    }
+
+    if constexpr (is_floating_point_v<T>) {
+        // infinities and signed zeros are ordinary values for sort
+        input = {T{0}, -T{0}, numeric_limits<T>::infinity(), -numeric_limits<T>::infinity(), T{1}, -T{0}, T{0}, T{-1}};
+        test_case_sort(input, actual, expected);
+
+        // mostly zeros of both signs, growing through every small-sort size; each zero must keep its sign
+        input.clear();
+        for (size_t attempts = 0; attempts < 100; ++attempts) {
+            const auto bits = gen();
+            input.push_back(bits % 8 == 0 ? T{1} : (bits & 8) != 0 ? -T{0} : T{0});
+            test_case_sort(input, actual, expected);
+        }
+    } else {
+        input = {numeric_limits<T>::max(), numeric_limits<T>::min(), T{0}, numeric_limits<T>::min(),
+            numeric_limits<T>::max(), T{1}};
+        test_case_sort(input, actual, expected);
+    }
+}
+
 template <class T>
 void test_swap_ranges(mt19937_64& gen) {
     const auto fn = [&]() { return static_cast<T>(gen()); };
@@ -823,7 +1410,10 @@ void test_vector_algorithms(mt19937_64& gen) {
     test_search<unsigned char>(gen);
     test_search<short>(gen);
     test_search<unsigned short>(gen);
-    // search() and find_end() are vectorized for 1 and 2 bytes only.
+    test_search<int>(gen);
+    test_search<unsigned int>(gen);
+    test_search<long long>(gen);
+    test_search<unsigned long long>(gen);
 
     test_min_max_element<char>(gen);
     test_min_max_element<signed char>(gen);
@@ -849,11 +1439,85 @@ void test_vector_algorithms(mt19937_64& gen) {
         vector<int64_t>{-6604286336755016904, -4365366089374418225, 6104371530830675888, -8582621853879131834});
 
     // replace() is vectorized for 4 and 8 bytes only.
+    test_adjacent_find<char>(gen);
+    test_adjacent_find<signed char>(gen);
+    test_adjacent_find<unsigned char>(gen);
+    test_adjacent_find<short>(gen);
+    test_adjacent_find<unsigned short>(gen);
+    test_adjacent_find<int>(gen);
+    test_adjacent_find<unsigned int>(gen);
+    test_adjacent_find<long long>(gen);
+    test_adjacent_find<unsigned long long>(gen);
+
+    test_is_sorted_until<char>(gen);
+    test_is_sorted_until<signed char>(gen);
+    test_is_sorted_until<unsigned char>(gen);
+    test_is_sorted_until<short>(gen);
+    test_is_sorted_until<unsigned short>(gen);
+    test_is_sorted_until<int>(gen);
+    test_is_sorted_until<unsigned int>(gen);
+    test_is_sorted_until<long long>(gen);
+    test_is_sorted_until<unsigned long long>(gen);
+    test_is_sorted_until<float>(gen);
+    test_is_sorted_until<double>(gen);
+    test_is_sorted_until<long double>(gen);
+
+    test_unique<char>(gen);
+    test_unique<signed char>(gen);
+    test_unique<unsigned char>(gen);
+    test_unique<short>(gen);
+    test_unique<unsigned short>(gen);
+    test_unique<int>(gen);
+    test_unique<unsigned int>(gen);
+    test_unique<long long>(gen);
+    test_unique<unsigned long long>(gen);
+
     test_replace<int>(gen);
     test_replace<unsigned int>(gen);
     test_replace<long long>(gen);
     test_replace<unsigned long long>(gen);
 
+    test_fill<short>(gen);
+    test_fill<unsigned short>(gen);
+    test_fill<int>(gen);
+    test_fill<unsigned int>(gen);
+    test_fill<long long>(gen);
+    test_fill<unsigned long long>(gen);
+    test_fill<float>(gen);
+    test_fill<double>(gen);
+    test_fill<long double>(gen);
+
+    test_transform<char>(gen);
+    test_transform<signed char>(gen);
+    test_transform<unsigned char>(gen);
+    test_transform<short>(gen);
+    test_transform<unsigned short>(gen);
+    test_transform<int>(gen);
+    test_transform<unsigned int>(gen);
+    test_transform<long long>(gen);
+    test_transform<unsigned long long>(gen);
+    test_transform<float>(gen);
+    test_transform<double>(gen);
+    test_transform<long double>(gen);
+
+    test_reduce<char>(gen);
+    test_reduce<signed char>(gen);
+    test_reduce<unsigned char>(gen);
+    test_reduce<short>(gen);
+    test_reduce<unsigned short>(gen);
+    test_reduce<int>(gen);
+    test_reduce<unsigned int>(gen);
+    test_reduce<long long>(gen);
+    test_reduce<unsigned long long>(gen);
+    test_reduce<float>(gen);
+    test_reduce<double>(gen);
+    test_reduce<long double>(gen);
+
+    test_lower_bound_batch<int>(gen);
+    test_lower_bound_batch<unsigned int>(gen);
+    test_lower_bound_batch<long long>(gen);
+    test_lower_bound_batch<char32_t>(gen);
+
     test_reverse<char>(gen);
     test_reverse<signed char>(gen);
     test_reverse<unsigned char>(gen);
@@ -880,6 +1544,12 @@ void test_vector_algorithms(mt19937_64& gen) {
     test_reverse_copy<double>(gen);
     test_reverse_copy<long double>(gen);
 
+    test_rotate<char>(gen);
+    test_rotate<short>(gen);
+    test_rotate<int>(gen);
+    test_rotate<long long>(gen);
+    test_rotate<double>(gen);
+
     test_remove<char>(gen);
     test_remove<signed char>(gen);
     test_remove<unsigned char>(gen);
@@ -890,6 +1560,16 @@ void test_vector_algorithms(mt19937_64& gen) {
     test_remove<long long>(gen);
     test_remove<unsigned long long>(gen);
 
+    test_sort<short>(gen);
+    test_sort<int>(gen);
+    test_sort<unsigned int>(gen);
+    test_sort<long>(gen);
+    test_sort<long long>(gen);
+    test_sort<unsigned long long>(gen);
+    test_sort<float>(gen);
+    test_sort<double>(gen);
+    test_sort<long double>(gen);
+
     test_swap_ranges<char>(gen);
     test_swap_ranges<short>(gen);
     test_swap_ranges<int>(gen);
@@ -1090,6 +1770,44 @@ void test_case_string_find_last_of(const basic_string<T>& input_haystack, const
     assert(expected == actual);
 }
 
+template <class T>
+size_t last_known_good_find_first_not_of(const basic_string<T>& h, const basic_string<T>& n) {
+    for (size_t pos = 0; pos != h.size(); ++pos) {
+        if (n.find(h[pos]) == basic_string<T>::npos) {
+            return pos;
+        }
+    }
+
+    return basic_string<T>::npos;
+}
+
+template <class T>
+void test_case_string_find_first_not_of(const basic_string<T>& input_haystack, const basic_string<T>& input_needle) {
+    size_t expected = last_known_good_find_first_not_of(input_haystack, input_needle);
+    size_t actual   = input_haystack.find_first_not_of(input_needle);
+    assert(expected == actual);
+}
+
+template <class T>
+size_t last_known_good_find_last_not_of(const basic_string<T>& h, const basic_string<T>& n) {
+    size_t pos = h.size();
+    while (pos != 0) {
+        --pos;
+        if (n.find(h[pos]) == basic_string<T>::npos) {
+            return pos;
+        }
+    }
+
+    return basic_string<T>::npos;
+}
+
+template <class T>
+void test_case_string_find_last_not_of(const basic_string<T>& input_haystack, const basic_string<T>& input_needle) {
+    size_t expected = last_known_good_find_last_not_of(input_haystack, input_needle);
+    size_t actual   = input_haystack.find_last_not_of(input_needle);
+    assert(expected == actual);
+}
+
 template <class T>
 void test_case_string_find_ch(const basic_string<T>& input_haystack, const T value) {
     ptrdiff_t expected;
@@ -1178,6 +1896,8 @@ void test_basic_string_dis(mt19937_64& gen, D& dis) {
 
         test_case_string_find_first_of(input_haystack, input_needle);
         test_case_string_find_last_of(input_haystack, input_needle);
+        test_case_string_find_first_not_of(input_haystack, input_needle);
+        test_case_string_find_last_not_of(input_haystack, input_needle);
         test_case_string_find_str(input_haystack, input_needle);
         test_case_string_rfind_str(input_haystack, input_needle);
 
@@ -1185,6 +1905,8 @@ void test_basic_string_dis(mt19937_64& gen, D& dis) {
             input_needle.push_back(static_cast<T>(dis(gen)));
             test_case_string_find_first_of(input_haystack, input_needle);
             test_case_string_find_last_of(input_haystack, input_needle);
+            test_case_string_find_first_not_of(input_haystack, input_needle);
+            test_case_string_find_last_not_of(input_haystack, input_needle);
             test_case_string_find_str(input_haystack, input_needle);
             test_case_string_rfind_str(input_haystack, input_needle);
 
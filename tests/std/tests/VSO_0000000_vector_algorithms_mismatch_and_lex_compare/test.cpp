@@ -5,7 +5,9 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdlib>
+#include <limits>
 #include <random>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -158,6 +160,73 @@ void test_mismatch_and_lex_compare_family_containers() {
 #endif // _HAS_CXX20
 }
 
+template <class T>
+void test_case_string_compare(const basic_string<T>& a, const basic_string<T>& b) {
+    const auto expected_mismatch = last_known_good_mismatch(a.begin(), a.end(), b.begin(), b.end());
+    const bool expected_lex      = last_known_good_lex_compare(expected_mismatch, a.end(), b.end());
+    const bool expected_equal    = expected_mismatch.first == a.end() && expected_mismatch.second == b.end();
+
+    assert((a < b) == expected_lex);
+    assert((a == b) == expected_equal);
+
+    const int actual_compare = a.compare(b);
+    assert((actual_compare < 0) == expected_lex);
+    assert((actual_compare == 0) == expected_equal);
+
+    const size_t common_size   = (min) (a.size(), b.size());
+    const int actual_traits    = char_traits<T>::compare(a.data(), b.data(), common_size);
+    const bool common_is_equal = expected_mismatch.first - a.begin() == static_cast<ptrdiff_t>(common_size);
+    assert((actual_traits == 0) == common_is_equal);
+    if (!common_is_equal) {
+        assert((actual_traits < 0) == (*expected_mismatch.first < *expected_mismatch.second));
+    }
+}
+
+template <class T>
+void test_string_compare(mt19937_64& gen) {
+    constexpr size_t shrinkCount   = 4;
+    constexpr size_t mismatchCount = 10;
+    // the highest value checks that the comparison treats the elements as unsigned
+    uniform_int_distribution<int> dis('a', 'z' + 1);
+    const auto next_char = [&] {
+        const int c = dis(gen);
+        return c == 'z' + 1 ? (numeric_limits<T>::max)() : static_cast<T>(c);
+    };
+
+    basic_string<T> input_a;
+    basic_string<T> input_b;
+    input_a.reserve(dataCount);
+    input_b.reserve(dataCount);
+
+    for (;;) {
+        test_case_string_compare(input_a, input_b);
+
+        for (size_t i = 0; i != shrinkCount && !input_b.empty(); ++i) {
+            input_b.pop_back();
+            test_case_string_compare(input_a, input_b);
+            test_case_string_compare(input_b, input_a);
+        }
+
+        if (!input_b.empty()) {
+            uniform_int_distribution<size_t> mismatch_dis(0, input_a.size() - 1);
+
+            for (size_t attempts = 0; attempts < mismatchCount; ++attempts) {
+                const size_t possible_mismatch_pos = mismatch_dis(gen);
+                input_a[possible_mismatch_pos]     = next_char();
+                test_case_string_compare(input_a, input_b);
+                test_case_string_compare(input_b, input_a);
+            }
+        }
+
+        if (input_a.size() == dataCount) {
+            break;
+        }
+
+        input_a.push_back(next_char());
+        input_b = input_a;
+    }
+}
+
 namespace test_mismatch_sizes_and_alignments {
     constexpr size_t range     = 33;
     constexpr size_t alignment = 32;
@@ -245,6 +314,10 @@ void test_vector_algorithms(mt19937_64& gen) {
     test_mismatch_and_lex_compare_family<long long>(gen);
     test_mismatch_and_lex_compare_family<unsigned long long>(gen);
 
+    test_string_compare<wchar_t>(gen);
+    test_string_compare<char16_t>(gen);
+    test_string_compare<char32_t>(gen);
+
     test_mismatch_and_lex_compare_family_containers<vector<char>, vector<signed char>>();
     test_mismatch_and_lex_compare_family_containers<vector<char>, vector<unsigned char>>();
     test_mismatch_and_lex_compare_family_containers<vector<wchar_t>, vector<char>>();
@@ -353,6 +353,18 @@ STATIC_ASSERT(__cpp_lib_filesystem == 201703L);
 #error __cpp_lib_filesystem is defined
 #endif
 
+#if _HAS_CXX23
+STATIC_ASSERT(__cpp_lib_flat_map == 202207L);
+#elif defined(__cpp_lib_flat_map)
+#error __cpp_lib_flat_map is defined
+#endif
+
+#if _HAS_CXX23
+STATIC_ASSERT(__cpp_lib_flat_set == 202207L);
+#elif defined(__cpp_lib_flat_set)
+#error __cpp_lib_flat_set is defined
+#endif
+
 #if _HAS_CXX20
 STATIC_ASSERT(__cpp_lib_format == 202304L);
 #elif defined(__cpp_lib_format)
@@ -495,6 +507,12 @@ STATIC_ASSERT(__cpp_lib_hypot == 201603L);
 
 STATIC_ASSERT(__cpp_lib_incomplete_container_elements == 201505L);
 
+#if _HAS_CXX23
+STATIC_ASSERT(__cpp_lib_inplace_vector == 202406L);
+#elif defined(__cpp_lib_inplace_vector)
+#error __cpp_lib_inplace_vector is defined
+#endif
+
 #if _HAS_CXX20
 STATIC_ASSERT(__cpp_lib_int_pow2 == 202002L);
 #elif defined(__cpp_lib_int_pow2)